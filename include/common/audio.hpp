@@ -0,0 +1,77 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+/**
+ * @brief 오디오 출력 대상 (16비트 모노 PCM)
+ * submit은 절대 대기하지 않는다. 공간이 없으면 받아들인 만큼만 반환한다.
+ */
+class AudioSink {
+public:
+    virtual ~AudioSink() = default;
+
+    virtual unsigned int sample_rate() const = 0;
+
+    /// @brief 아직 재생되지 않고 대기 중인 샘플 수
+    virtual std::size_t queued() const = 0;
+
+    /// @brief 샘플을 넣고 실제로 받아들인 개수를 반환 (에뮬레이션 스레드에서 호출)
+    virtual std::size_t submit(const int16_t* samples, std::size_t count) = 0;
+};
+
+/**
+ * @brief 소리를 내지 않는 출력 (헤드리스 실행, --mute, 오디오 장치를 열 수 없을 때)
+ * 항상 가득 찬 것으로 보고하므로 Beeper가 샘플을 합성하지 않는다.
+ */
+class NullAudioSink : public AudioSink {
+public:
+    unsigned int sample_rate() const override { return 44100; }
+    std::size_t queued() const override { return std::numeric_limits<std::size_t>::max(); }
+    std::size_t submit(const int16_t*, std::size_t count) override { return count; }
+};
+
+/**
+ * @brief 사운드 타이머로 켜고 끄는 비퍼 합성기
+ *
+ * pump()를 자주 호출하면 출력 대기열을 목표 지연 시간만큼만 채운다 (top-up).
+ * 에뮬레이터가 실시간보다 빠르면 대기열이 이미 차 있어 합성하지 않고,
+ * 느리면 부족한 만큼만 합성하므로 속도와 관계없이 지연이 일정하게 유지된다.
+ * 위상과 음량은 호출 사이에 이어지고, 켜고 끌 때 짧게 페이드해서 클릭 노이즈를 막는다.
+ */
+class Beeper {
+public:
+    static constexpr float DEFAULT_FREQUENCY = 440.0f;  // 기본 구형파 주파수 (Hz)
+
+    explicit Beeper(AudioSink& sink);
+
+    void set_frequency(float hz) { frequency_ = hz; }
+    void set_volume(float volume) { volume_ = volume; }
+
+    /**
+     * @brief XO-CHIP 오디오 패턴 (128개 1비트 샘플, MSB 먼저)과 피치 설정
+     * 재생 속도 = 4000 * 2^((pitch - 64) / 48) 비트/초. 패턴이 모두 0이면 기본 구형파를 사용한다.
+     */
+    void set_pattern(const uint8_t* pattern, uint8_t pitch);
+
+    /// @brief 목표 지연까지 대기열을 채움 (active = 사운드 타이머 > 0)
+    void pump(bool active);
+
+private:
+    float next_sample(bool active);
+
+    AudioSink& sink_;
+    std::size_t target_queued_;      // 목표 대기 샘플 수 (약 2프레임)
+
+    float frequency_ = DEFAULT_FREQUENCY;
+    float volume_ = 0.25f;
+    double phase_ = 0.0;             // 구형파: 주기 단위 [0, 1), 패턴: 비트 단위 [0, 128)
+    float level_ = 0.0f;             // 현재 음량 (페이드용)
+    float fade_step_;                // 샘플당 음량 변화 (약 2ms 페이드)
+
+    std::array<uint8_t, 16> pattern_{};
+    bool use_pattern_ = false;
+    double pattern_rate_ = 4000.0;   // 비트/초
+};
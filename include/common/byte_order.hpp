@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+/**
+ * @brief 빅엔디언 32비트 값 읽기 (4바이트 memcpy 한 번 + 호스트가 리틀엔디언이면 byteswap)
+ * CHIP-8 계열 명령어는 빅엔디언으로 저장되므로 fetch 경로에서 사용한다.
+ */
+inline uint32_t load_be32(const uint8_t* p) {
+    uint32_t word;
+    std::memcpy(&word, p, sizeof(word));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    return word;
+#elif defined(__GNUC__)
+    return __builtin_bswap32(word);
+#else
+    return ((word & 0x000000FFu) << 24) | ((word & 0x0000FF00u) << 8) |
+           ((word & 0x00FF0000u) >> 8) | ((word & 0xFF000000u) >> 24);
+#endif
+}
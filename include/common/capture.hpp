@@ -0,0 +1,83 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "common/frame.hpp"
+#include "spsc_ring.hpp"
+
+/**
+ * @brief 프레임 경계마다 화면을 파일로 기록하는 캡처 출력 (SDL 비의존, 헤드리스 실행용)
+ *
+ * 에뮬레이션 스레드의 submit()은 픽셀 인덱스 버퍼를 큐에 복사만 하고 돌아가며,
+ * 색 변환 / 중복 프레임 판별 / 파일 쓰기는 모두 백그라운드 writer 스레드가 한다.
+ * 큐가 가득 찬 경우에만 (디스크가 느릴 때) 생산자가 잠깐 기다린다. 프레임은 버리지 않는다.
+ *
+ * 출력 형식은 확장자로 고른다.
+ *   .y4m : YUV4MPEG2 (C444, 60fps). 표준에 반복 표시가 없으므로 같은 프레임은
+ *          변환 없이 직전 결과를 다시 쓴다.
+ *   그 외 : raw RGBA. 헤더 "CHIP8RAW <w> <h> 60\n" 뒤에 레코드가 이어진다.
+ *          'F' + w*h*4 바이트 (R, G, B, A 순) = 새 프레임
+ *          'R' + uint32 little-endian n     = 직전 프레임이 n번 더 반복됨
+ *
+ * 출력 크기는 open() 때 고정하며, 그보다 작은 화면(저해상도 모드)은 최근접 확대한다.
+ */
+class FrameCapture {
+public:
+    enum class Format { Y4m, Raw };
+
+    static constexpr std::size_t QUEUE_FRAMES = 32;
+
+    FrameCapture() = default;
+    ~FrameCapture();
+
+    FrameCapture(const FrameCapture&) = delete;
+    FrameCapture& operator=(const FrameCapture&) = delete;
+
+    /// @brief 파일을 열고 writer 스레드 시작 (실패하면 false)
+    bool open(const std::string& path, unsigned int width, unsigned int height, const Palette& palette = Palette{});
+
+    /// @brief 프레임 하나 기록 (프레임 경계마다 화면이 바뀌지 않았어도 호출)
+    void submit(const FrameView& frame);
+
+    /// @brief 남은 프레임을 모두 쓰고 파일을 닫음 (소멸자에서도 호출)
+    void close();
+
+    bool is_open() const { return file_ != nullptr; }
+    Format format() const { return format_; }
+
+    uint64_t frames() const { return frames_.load(std::memory_order_relaxed); }     // 기록한 전체 프레임 수
+    uint64_t repeats() const { return repeats_.load(std::memory_order_relaxed); }   // 그중 직전과 같았던 프레임 수
+    uint64_t stalls() const { return stalls_; }                                      // 큐가 가득 차서 기다린 횟수
+
+private:
+    void run();
+    void write_frame(const FrameBuffer& frame);
+    void flush_repeats();
+    void convert(const FrameBuffer& frame);
+
+    std::FILE* file_ = nullptr;
+    Format format_ = Format::Raw;
+    unsigned int width_ = 0;
+    unsigned int height_ = 0;
+
+    // writer 스레드 전용
+    std::array<uint8_t, 256 * 4> lut_{};       // 픽셀 값 → 출력 바이트 (RGBA 또는 Y, U, V)
+    std::vector<uint8_t> converted_;           // 직전 프레임 변환 결과
+    FrameBuffer last_{};                        // 직전 프레임 (중복 판별용)
+    bool has_last_ = false;
+    uint32_t pending_repeats_ = 0;
+
+    std::unique_ptr<SpscRing<FrameBuffer, QUEUE_FRAMES>> queue_;
+    std::thread writer_;
+    std::atomic<bool> running_{false};
+    std::atomic<uint64_t> frames_{0};
+    std::atomic<uint64_t> repeats_{0};
+    FrameBuffer staging_{};                     // 생산자 전용 (큐에 넣기 전 화면 크기만큼만 복사)
+    uint64_t stalls_ = 0;                       // 생산자 전용
+};
@@ -4,8 +4,23 @@
 constexpr unsigned int VIDEO_WIDTH = 64;
 constexpr unsigned int VIDEO_HEIGHT = 32;
 
+// SUPER-CHIP / XO-CHIP 고해상도 모드 (00FF)
+constexpr unsigned int VIDEO_WIDTH_HI = 128;
+constexpr unsigned int VIDEO_HEIGHT_HI = 64;
+
+// Chip8_32 고해상도 모드의 최대 해상도 (64x32 / 128x64 / 256x128 중 가장 큰 크기)
+constexpr unsigned int VIDEO_WIDTH_MAX = 256;
+constexpr unsigned int VIDEO_HEIGHT_MAX = 128;
+
 // CHIP-8은 16개의 키를 가짐 (0x0 ~ 0xF)
 constexpr unsigned int NUM_KEYS = 16;
 
+// 프레임 / 지연·사운드 타이머 갱신 주기 (60Hz)
+constexpr unsigned int FRAME_RATE = 60;
+
+// 프레임당 실행할 명령어 수 기본값 (--ipf로 변경)
+constexpr unsigned int DEFAULT_IPF_8 = 10;   // 약 600 명령어/초
+constexpr unsigned int DEFAULT_IPF_32 = 8;   // 약 500 명령어/초 (기존 2ms 간격 실행과 비슷한 속도)
+
 // 화면 확대 배율 (64x32 화면을 크게 보이게 하기 위한 배수)
 constexpr unsigned int SCALE = 10;
\ No newline at end of file
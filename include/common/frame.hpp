@@ -0,0 +1,119 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <string>
+#include "common/constants.hpp"
+#include "common/xxhash.hpp"
+
+/**
+ * @brief 코어의 화면 버퍼를 플랫폼에 넘기기 위한 읽기 전용 뷰
+ * 픽셀은 1바이트(0 = 꺼짐, 그 외 = 켜짐)이고 행 사이 간격(pitch)은 width와 같다.
+ */
+struct FrameView {
+    const uint8_t* pixels;
+    unsigned int width;
+    unsigned int height;
+};
+
+/**
+ * @brief 완성된 한 프레임의 복사본 (렌더 스레드로 넘기는 삼중 버퍼 원소)
+ * 가장 큰 해상도 크기로 고정 할당해 해상도가 바뀌어도 재할당하지 않는다.
+ */
+struct FrameBuffer {
+    std::array<uint8_t, VIDEO_WIDTH_MAX * VIDEO_HEIGHT_MAX> pixels;
+    unsigned int width = VIDEO_WIDTH;
+    unsigned int height = VIDEO_HEIGHT;
+
+    void assign(const FrameView& view) {
+        width = view.width;
+        height = view.height;
+        std::copy(view.pixels, view.pixels + width * height, pixels.begin());
+    }
+
+    FrameView view() const { return {pixels.data(), width, height}; }
+};
+
+/**
+ * @brief 픽셀 값 → 화면 색 (RGBA8888, 0xRRGGBBAA)
+ * 0 = 배경, 1 = 전경(평면 1), 2 = 평면 2, 3 = 두 평면 겹침 (XO-CHIP). 4 이상은 전경으로 표시한다.
+ */
+struct Palette {
+    std::array<uint32_t, 4> colors = {0x000000FF, 0xFFFFFFFF, 0xAAAAAAFF, 0x555555FF};
+
+    uint32_t& background() { return colors[0]; }
+    uint32_t& foreground() { return colors[1]; }
+};
+
+/// @brief "RRGGBB" 또는 "#RRGGBB" 16진수 색을 RGBA8888로 파싱
+inline bool parse_color(const std::string& text, uint32_t& rgba) {
+    std::string hex = !text.empty() && text[0] == '#' ? text.substr(1) : text;
+    if (hex.size() != 6) return false;
+    uint32_t rgb = 0;
+    for (char c : hex) {
+        int digit;
+        if (c >= '0' && c <= '9') digit = c - '0';
+        else if (c >= 'a' && c <= 'f') digit = c - 'a' + 10;
+        else if (c >= 'A' && c <= 'F') digit = c - 'A' + 10;
+        else return false;
+        rgb = (rgb << 4) | static_cast<uint32_t>(digit);
+    }
+    rgba = (rgb << 8) | 0xFF;
+    return true;
+}
+
+namespace frame {
+
+/**
+ * @brief 8 또는 16픽셀 폭 스프라이트를 XOR로 그린다 (화면 끝에서 반대편으로 wrap)
+ * 비용은 스프라이트 크기(count x sprite_width)에만 비례하고 화면 크기와는 무관하다.
+ * @param pixels width x height 화면 버퍼 (픽셀 바이트의 각 비트가 비트플레인 하나)
+ * @param rows 스프라이트 행 데이터 (행당 sprite_width / 8 바이트, MSB가 가장 왼쪽 픽셀)
+ * @param sprite_width 8 또는 16
+ * @param plane 그릴 비트플레인 비트 (기본 1 = 단일 평면)
+ * @param clip true면 시작 좌표만 wrap하고 화면 밖으로 나간 행/열은 그리지 않음
+ * @return 해당 평면에서 켜져 있던 픽셀을 하나라도 지웠으면 true (충돌)
+ */
+inline bool xor_sprite(uint8_t* pixels, unsigned int width, unsigned int height,
+                       unsigned int x, unsigned int y, const uint8_t* rows, unsigned int count,
+                       unsigned int sprite_width = 8, uint8_t plane = 1, bool clip = false) {
+    // 잘라내기는 그릴 행/열 수만 줄이므로 픽셀 루프에는 분기가 늘지 않음
+    unsigned int visible_cols = sprite_width;
+    if (clip) {
+        x %= width;
+        y %= height;
+        if (width - x < visible_cols) visible_cols = width - x;
+        if (height - y < count) count = height - y;
+    }
+
+    // 열 wrap은 스프라이트마다 한 번만 미리 계산
+    unsigned int columns[16];
+    for (unsigned int col = 0; col < visible_cols; ++col) columns[col] = (x + col) % width;
+
+    const unsigned int bytes_per_row = sprite_width / 8;
+    const uint16_t first_bit = static_cast<uint16_t>(1u << (sprite_width - 1));
+    uint8_t collision = 0;
+    for (unsigned int row = 0; row < count; ++row) {
+        const uint8_t* data = rows + row * bytes_per_row;
+        uint16_t bits = bytes_per_row == 2 ? static_cast<uint16_t>((data[0] << 8) | data[1]) : data[0];
+        if (!bits) continue;
+        uint8_t* line = pixels + ((y + row) % height) * width;
+        for (unsigned int col = 0; col < visible_cols; ++col) {
+            if (bits & (first_bit >> col)) {
+                uint8_t& pixel = line[columns[col]];
+                collision |= pixel & plane;
+                pixel ^= plane;
+            }
+        }
+    }
+    return collision != 0;
+}
+
+/// @brief 화면 내용 해시 (XXH64, 해상도도 시드에 반영). 골든 프레임 비교용
+inline uint64_t hash(const FrameView& view) {
+    const uint64_t seed = (static_cast<uint64_t>(view.width) << 32) | view.height;
+    return xxhash::hash64(view.pixels, static_cast<std::size_t>(view.width) * view.height, seed);
+}
+
+} // namespace frame
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "common/constants.hpp"
+#include "spsc_ring.hpp"
+
+/// @brief 키패드 키 하나의 눌림/뗌 (플랫폼 → 에뮬레이션 스레드)
+struct KeyEvent {
+    uint8_t key;      // 0x0 ~ 0xF
+    bool pressed;
+    uint64_t time_ns; // 플랫폼이 이벤트를 받은 시각 (timer::now_ns 기준)
+};
+
+// 렌더 스레드가 넣고 에뮬레이션 스레드가 꺼내는 입력 큐
+using KeyEventQueue = SpscRing<KeyEvent, 64>;
+
+/**
+ * @brief 호스트 키 → CHIP-8 키패드 매핑 테이블
+ * 키패드 0x0 ~ 0xF 순서로 호스트 키 16개를 적은 문자열로 설정한다.
+ * 기본값 "x123qweasdzc4rfv"는 왼쪽 4x4 블록을 원래 키패드 배치대로 쓴다.
+ *   1 2 3 4      1 2 3 C
+ *   Q W E R  →   4 5 6 D
+ *   A S D F      7 8 9 E
+ *   Z X C V      A 0 B F
+ * 인쇄 가능한 ASCII 키만 지원하며 (SDL 키코드와 값이 같음) 조회는 배열 한 번 읽기다.
+ */
+class Keymap {
+public:
+    static constexpr const char* DEFAULT = "x123qweasdzc4rfv";
+
+    Keymap() { parse(DEFAULT); }
+
+    /// @brief 키패드 순서 16글자 문자열로 설정 (중복 키나 길이 오류면 false, 기존 값 유지)
+    bool parse(const std::string& layout) {
+        if (layout.size() != NUM_KEYS) return false;
+        std::array<int8_t, 128> table;
+        table.fill(-1);
+        for (unsigned int key = 0; key < NUM_KEYS; ++key) {
+            unsigned char c = static_cast<unsigned char>(layout[key]);
+            if (c >= 'A' && c <= 'Z') c = static_cast<unsigned char>(c - 'A' + 'a');
+            if (c <= ' ' || c >= 127 || table[c] >= 0) return false;
+            table[c] = static_cast<int8_t>(key);
+        }
+        table_ = table;
+        return true;
+    }
+
+    /// @brief 호스트 키코드에 해당하는 키패드 번호 (매핑 없으면 -1)
+    int lookup(int32_t keycode) const {
+        return keycode >= 0 && keycode < 128 ? table_[keycode] : -1;
+    }
+
+private:
+    std::array<int8_t, 128> table_;
+};
+
+/**
+ * @brief 프레임 단위 입력 적용기 (에뮬레이션 스레드 전용)
+ *
+ * 프레임 시작 시 begin_frame()으로 큐를 한 번만 비우고, 각 이벤트를 직전 프레임 구간 안에서
+ * 발생한 시각 비율에 따라 "몇 번째 명령어 직전에 반영할지"로 바꿔 둔다.
+ * 실행 루프는 명령어마다 apply()를 부르며, 같은 (프레임, 명령어 번호, 키) 목록이면
+ * 실행 결과가 항상 같으므로 결정성과 리플레이가 유지된다.
+ */
+class InputScheduler {
+public:
+    struct ScheduledKey {
+        uint32_t instruction;   // 이 번호의 명령어를 실행하기 직전에 반영
+        uint8_t key;
+        bool pressed;
+    };
+
+    static constexpr std::size_t MAX_EVENTS_PER_FRAME = 64;
+
+    /**
+     * @brief 큐의 이벤트를 이번 프레임의 명령어 위치로 배치
+     * @param now_ns 현재 시각 (이번 구간의 끝)
+     * @param ipf 이번 프레임에 실행할 명령어 수
+     */
+    void begin_frame(KeyEventQueue& queue, uint64_t now_ns, uint32_t ipf) {
+        const uint64_t start = last_poll_ns_ ? last_poll_ns_ : now_ns;
+        const uint64_t span = now_ns > start ? now_ns - start : 0;
+        last_poll_ns_ = now_ns;
+        count_ = 0;
+        next_ = 0;
+
+        KeyEvent event;
+        while (count_ < MAX_EVENTS_PER_FRAME && queue.try_pop(event)) {
+            uint32_t index = 0;
+            if (span && ipf && event.time_ns > start) {
+                uint64_t offset = event.time_ns - start;
+                index = offset >= span ? ipf - 1 : static_cast<uint32_t>(offset * ipf / span);
+            }
+            // 시각은 큐 순서대로 증가하지만, 혹시 역전되더라도 순서를 지키도록 앞 이벤트 위치 이상으로
+            if (count_ && index < events_[count_ - 1].instruction) index = events_[count_ - 1].instruction;
+            events_[count_++] = {index, event.key, event.pressed};
+            snapshot_[event.key] = event.pressed;
+        }
+    }
+
+    /// @brief instruction번째 명령어 직전에 반영할 이벤트가 있으면 키패드에 적용
+    void apply(uint32_t instruction, std::array<uint8_t, NUM_KEYS>& keypad) {
+        while (next_ < count_ && events_[next_].instruction <= instruction) {
+            keypad[events_[next_].key] = events_[next_].pressed;
+            ++next_;
+        }
+    }
+
+    /// @brief 프레임이 일찍 끝난 경우(정지, 디버거) 남은 이벤트를 모두 반영
+    void finish(std::array<uint8_t, NUM_KEYS>& keypad) {
+        apply(UINT32_MAX, keypad);
+    }
+
+    /// @brief 이번 프레임 이벤트를 모두 반영한 뒤의 키패드 상태
+    const std::array<uint8_t, NUM_KEYS>& snapshot() const { return snapshot_; }
+
+    /// @brief 이번 프레임에 배치된 이벤트 (기록/리플레이용)
+    const ScheduledKey* events() const { return events_.data(); }
+    std::size_t event_count() const { return count_; }
+
+private:
+    std::array<ScheduledKey, MAX_EVENTS_PER_FRAME> events_{};
+    std::size_t count_ = 0;
+    std::size_t next_ = 0;
+    uint64_t last_poll_ns_ = 0;
+    std::array<uint8_t, NUM_KEYS> snapshot_{};
+};
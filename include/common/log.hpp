@@ -0,0 +1,144 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief 레벨/카테고리 기반 로깅
+ *
+ * - 컴파일 타임: CHIP8_LOG_LEVEL 미만 레벨의 LOG_* 매크로는 ((void)0)으로 사라진다.
+ *   (인자 평가, 포맷팅 비용 모두 없음)
+ * - 런타임: 메시지를 받을 Sink의 레벨과 카테고리 마스크로 한 번 더 거른다.
+ * - Sink는 스레드별로 고른다: ScopedSink가 걸려 있으면 그 Sink, 없으면 프로그램이 등록한
+ *   기본 Sink (set_default_sink), 둘 다 없으면 메시지를 버린다.
+ *   코어 라이브러리는 스레드나 출력 버퍼를 갖지 않으며, C API는 인스턴스마다 자기 Sink를 건다.
+ *   콘솔 출력은 프런트엔드의 log_console.hpp 참고.
+ */
+
+#define CHIP8_LOG_LEVEL_TRACE 0
+#define CHIP8_LOG_LEVEL_DEBUG 1
+#define CHIP8_LOG_LEVEL_INFO  2
+#define CHIP8_LOG_LEVEL_WARN  3
+#define CHIP8_LOG_LEVEL_ERROR 4
+#define CHIP8_LOG_LEVEL_OFF   5
+
+#ifndef CHIP8_LOG_LEVEL
+#define CHIP8_LOG_LEVEL CHIP8_LOG_LEVEL_INFO
+#endif
+
+namespace logging {
+
+enum class Level : uint8_t {
+    Trace = CHIP8_LOG_LEVEL_TRACE,
+    Debug = CHIP8_LOG_LEVEL_DEBUG,
+    Info = CHIP8_LOG_LEVEL_INFO,
+    Warn = CHIP8_LOG_LEVEL_WARN,
+    Error = CHIP8_LOG_LEVEL_ERROR,
+    Off = CHIP8_LOG_LEVEL_OFF
+};
+
+// 서브시스템 카테고리 (카테고리 마스크의 비트 위치)
+enum class Category : uint8_t {
+    General,
+    Cpu8,
+    Cpu32,
+    Video,
+    Debugger,
+    Platform,
+    Count
+};
+
+constexpr uint32_t ALL_CATEGORIES = (1u << static_cast<uint32_t>(Category::Count)) - 1;
+
+constexpr std::size_t MESSAGE_SIZE = 240;   // 포맷팅된 메시지 최대 길이 (넘으면 잘림)
+
+/// @brief 포맷팅된 메시지를 받는 곳 (text는 호출 동안만 유효)
+struct Sink {
+    using Emit = void (*)(void* user, Level level, Category category, const char* text);
+
+    Emit emit = nullptr;    // nullptr이면 모든 메시지를 버림
+    void* user = nullptr;
+    std::atomic<uint8_t> level{static_cast<uint8_t>(CHIP8_LOG_LEVEL)};
+    std::atomic<uint32_t> categories{ALL_CATEGORIES};
+
+    constexpr Sink() = default;
+    constexpr Sink(Emit emit_fn, void* user_data) : emit(emit_fn), user(user_data) {}
+
+    bool accepts(Level message_level, Category category) const {
+        return emit && static_cast<uint8_t>(message_level) >= level.load(std::memory_order_relaxed) &&
+               (categories.load(std::memory_order_relaxed) & (1u << static_cast<uint32_t>(category)));
+    }
+};
+
+/// @brief 살아 있는 동안 현재 스레드의 메시지를 sink로 보냄 (중첩 가능, 소멸 시 이전 Sink로 복귀)
+class ScopedSink {
+public:
+    explicit ScopedSink(const Sink* sink);
+    ~ScopedSink();
+    ScopedSink(const ScopedSink&) = delete;
+    ScopedSink& operator=(const ScopedSink&) = delete;
+
+private:
+    const Sink* previous_;
+};
+
+/// @brief ScopedSink가 없는 스레드의 메시지를 받을 Sink (nullptr이면 버림, 기본값)
+void set_default_sink(const Sink* sink);
+
+/// @brief 현재 스레드의 Sink가 이 메시지를 받는지 (thread_local 포인터 + atomic 두 번 읽기)
+bool enabled(Level level, Category category);
+
+/// @brief printf 형식 메시지를 호출 스레드에서 포맷팅해 현재 Sink로 넘긴다 (LOG_* 매크로를 통해 호출)
+#if defined(__GNUC__)
+__attribute__((format(printf, 3, 4)))
+#endif
+void write(Level level, Category category, const char* fmt, ...);
+
+/// @brief "trace", "debug", "info", "warn", "error", "off" 파싱
+bool parse_level(const std::string& text, Level& level);
+
+/// @brief "cpu32,video" 처럼 쉼표로 구분된 카테고리 목록 파싱 ("all" 허용)
+bool parse_categories(const std::string& text, uint32_t& mask);
+
+const char* level_name(Level level);
+const char* category_name(Category category);
+
+} // namespace logging
+
+#define CHIP8_LOG_IMPL(level, category, ...)                                  \
+    do {                                                                      \
+        if (::logging::enabled(level, ::logging::Category::category))         \
+            ::logging::write(level, ::logging::Category::category, __VA_ARGS__); \
+    } while (0)
+
+#if CHIP8_LOG_LEVEL <= CHIP8_LOG_LEVEL_TRACE
+#define LOG_TRACE(category, ...) CHIP8_LOG_IMPL(::logging::Level::Trace, category, __VA_ARGS__)
+#else
+#define LOG_TRACE(category, ...) ((void)0)
+#endif
+
+#if CHIP8_LOG_LEVEL <= CHIP8_LOG_LEVEL_DEBUG
+#define LOG_DEBUG(category, ...) CHIP8_LOG_IMPL(::logging::Level::Debug, category, __VA_ARGS__)
+#else
+#define LOG_DEBUG(category, ...) ((void)0)
+#endif
+
+#if CHIP8_LOG_LEVEL <= CHIP8_LOG_LEVEL_INFO
+#define LOG_INFO(category, ...) CHIP8_LOG_IMPL(::logging::Level::Info, category, __VA_ARGS__)
+#else
+#define LOG_INFO(category, ...) ((void)0)
+#endif
+
+#if CHIP8_LOG_LEVEL <= CHIP8_LOG_LEVEL_WARN
+#define LOG_WARN(category, ...) CHIP8_LOG_IMPL(::logging::Level::Warn, category, __VA_ARGS__)
+#else
+#define LOG_WARN(category, ...) ((void)0)
+#endif
+
+#if CHIP8_LOG_LEVEL <= CHIP8_LOG_LEVEL_ERROR
+#define LOG_ERROR(category, ...) CHIP8_LOG_IMPL(::logging::Level::Error, category, __VA_ARGS__)
+#else
+#define LOG_ERROR(category, ...) ((void)0)
+#endif
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "common/log.hpp"
+
+/**
+ * @brief 프런트엔드용 콘솔 로그 출력 (src/common/log_console.cpp, 코어 라이브러리에는 들어가지 않음)
+ *
+ * install_console()로 기본 Sink가 되면, 메시지는 호출 스레드에서 고정 크기 슬롯에 복사된 뒤
+ * lock-free 링 버퍼에 들어가고 백그라운드 스레드가 꺼내서 출력한다 (첫 메시지에서 시작).
+ * 호출 스레드는 I/O나 flush로 막히지 않으며, 버퍼가 가득 차면 메시지를 버리고 개수만 센다.
+ */
+
+namespace logging {
+
+/// @brief 콘솔 Sink를 기본 Sink로 등록 (Warn 이상은 stderr, 나머지는 stdout)
+void install_console();
+
+void set_level(Level level);
+void set_category_mask(uint32_t mask);
+
+/// @brief 버퍼에 남은 메시지를 모두 출력할 때까지 대기
+void flush();
+
+/// @brief 버퍼가 가득 차서 버려진 메시지 수
+uint64_t dropped_count();
+
+} // namespace logging
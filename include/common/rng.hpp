@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief 코어별 의사 난수 생성기 (xorshift32)
+ * 전역 rand()와 달리 코어 인스턴스마다 상태를 가지므로, 같은 시드로 시작하면
+ * 다른 코어나 실행 순서와 관계없이 항상 같은 난수열이 나온다 (CXNN 결정성, 골든 프레임 테스트).
+ */
+class Xorshift32 {
+public:
+    static constexpr uint32_t DEFAULT_SEED = 0x2545F491;
+
+    explicit Xorshift32(uint32_t seed = DEFAULT_SEED) { reseed(seed); }
+
+    /// @brief 상태를 시드로 되돌림 (0은 xorshift의 고정점이라 기본 시드로 대체)
+    void reseed(uint32_t seed) { state_ = seed ? seed : DEFAULT_SEED; }
+
+    uint32_t next() {
+        state_ ^= state_ << 13;
+        state_ ^= state_ >> 17;
+        state_ ^= state_ << 5;
+        return state_;
+    }
+
+private:
+    uint32_t state_;
+};
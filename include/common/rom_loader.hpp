@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// @brief ROM 로드 실패 원인 (None = 성공)
+enum class RomError : uint8_t {
+    None,
+    OpenFailed,      // 파일이 없거나 열 권한이 없음
+    NotRegularFile,  // 디렉토리 등 일반 파일이 아님
+    ReadFailed,      // 매핑/읽기 실패
+    Empty,           // 0바이트 파일
+    TooLarge         // 대상 머신의 프로그램 영역보다 큼
+};
+
+/// @brief 오류 설명 문자열 (사용자 출력용)
+const char* rom_error_message(RomError error);
+
+/**
+ * @brief 읽기 전용으로 연 ROM 이미지
+ *
+ * POSIX에서는 파일을 읽기 전용 mmap으로 매핑해 복사 없이 바로 쓰고,
+ * 매핑할 수 없는 경우(비 POSIX, 특수 파일 등)에만 버퍼로 한 번 읽는다.
+ * 크기는 open() 시점에 fstat으로 먼저 검사하므로 너무 큰 파일은 매핑하지 않는다.
+ */
+class RomImage {
+public:
+    RomImage() = default;
+    ~RomImage();
+
+    RomImage(const RomImage&) = delete;
+    RomImage& operator=(const RomImage&) = delete;
+    RomImage(RomImage&& other) noexcept;
+    RomImage& operator=(RomImage&& other) noexcept;
+
+    /// @brief 파일을 열고 크기 검사 후 매핑 (max_size 초과면 TooLarge, 기존 이미지는 닫힘)
+    RomError open(const char* path, std::size_t max_size = SIZE_MAX);
+    void close();
+
+    const uint8_t* data() const { return data_; }
+    std::size_t size() const { return size_; }
+    bool is_mapped() const { return map_ != nullptr; }
+
+private:
+    const uint8_t* data_ = nullptr;
+    std::size_t size_ = 0;
+    void* map_ = nullptr;            // mmap 영역 (버퍼로 읽은 경우 nullptr)
+    std::vector<uint8_t> buffer_;    // mmap을 못 쓸 때의 대체 버퍼
+};
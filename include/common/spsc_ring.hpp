@@ -0,0 +1,63 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+/**
+ * @brief 단일 생산자 / 단일 소비자 lock-free 링 버퍼
+ * 생산자 스레드만 push, 소비자 스레드만 pop을 호출해야 한다.
+ * 양쪽 모두 대기하지 않으며, 공간/데이터가 부족하면 처리한 개수만 돌려준다.
+ * @tparam Capacity 슬롯 수 (2의 거듭제곱)
+ */
+template <typename T, std::size_t Capacity>
+class SpscRing {
+public:
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+    static constexpr std::size_t capacity() { return Capacity; }
+
+    /// @brief 최대 count개를 넣고 실제로 넣은 개수를 반환 (생산자 전용)
+    std::size_t push(const T* data, std::size_t count) {
+        std::size_t tail = tail_.load(std::memory_order_relaxed);
+        std::size_t head = head_.load(std::memory_order_acquire);
+        std::size_t n = std::min(count, Capacity - (tail - head));
+
+        std::size_t start = tail & (Capacity - 1);
+        std::size_t first = std::min(n, Capacity - start);
+        std::copy(data, data + first, buffer_.begin() + start);
+        std::copy(data + first, data + n, buffer_.begin());
+
+        tail_.store(tail + n, std::memory_order_release);
+        return n;
+    }
+
+    /// @brief 최대 count개를 꺼내고 실제로 꺼낸 개수를 반환 (소비자 전용)
+    std::size_t pop(T* out, std::size_t count) {
+        std::size_t head = head_.load(std::memory_order_relaxed);
+        std::size_t tail = tail_.load(std::memory_order_acquire);
+        std::size_t n = std::min(count, tail - head);
+
+        std::size_t start = head & (Capacity - 1);
+        std::size_t first = std::min(n, Capacity - start);
+        std::copy(buffer_.begin() + start, buffer_.begin() + start + first, out);
+        std::copy(buffer_.begin(), buffer_.begin() + (n - first), out + first);
+
+        head_.store(head + n, std::memory_order_release);
+        return n;
+    }
+
+    bool try_push(const T& value) { return push(&value, 1) == 1; }
+    bool try_pop(T& value) { return pop(&value, 1) == 1; }
+
+    /// @brief 현재 들어 있는 개수 (다른 스레드가 동시에 움직이면 근사값)
+    std::size_t size() const {
+        return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+    }
+
+private:
+    std::array<T, Capacity> buffer_{};
+    alignas(64) std::atomic<std::size_t> head_{0};  // 소비자 읽기 위치
+    alignas(64) std::atomic<std::size_t> tail_{0};  // 생산자 쓰기 위치
+};
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief 32비트 레지스터 하나를 8비트 4레인 / 16비트 2레인으로 보고 연산하는 SWAR 커널
+ * 레인 0은 최하위 바이트(워드)이며, 어떤 연산도 레인 경계를 넘어 carry가 번지지 않는다.
+ * 분기 없이 정수 연산만 사용하므로 호스트 컴파일러가 그대로 스칼라 몇 개 명령으로 내린다.
+ */
+namespace swar {
+
+constexpr uint32_t LO7_8  = 0x7F7F7F7Fu;   // 8비트 레인별 하위 7비트
+constexpr uint32_t HI_8   = 0x80808080u;   // 8비트 레인별 MSB
+constexpr uint32_t LO15_16 = 0x7FFF7FFFu;  // 16비트 레인별 하위 15비트
+constexpr uint32_t HI_16  = 0x80008000u;   // 16비트 레인별 MSB
+
+// 레인별 MSB 비트(HI_8 / HI_16 위치)를 해당 레인 전체 1 마스크로 확장
+constexpr uint32_t expand8(uint32_t msb)  { return (msb >> 7) * 0xFFu; }
+constexpr uint32_t expand16(uint32_t msb) { return (msb >> 15) * 0xFFFFu; }
+
+/// @brief 8비트 레인별 부호 없는 포화 덧셈
+constexpr uint32_t add_sat_u8(uint32_t a, uint32_t b) {
+    uint32_t sum = ((a & LO7_8) + (b & LO7_8)) ^ ((a ^ b) & HI_8);   // 레인별 wrap 덧셈
+    uint32_t carry = ((a & b) | ((a | b) & ~sum)) & HI_8;             // 레인 MSB에서 나간 carry
+    return sum | expand8(carry);
+}
+
+/// @brief 8비트 레인별 부호 없는 포화 뺄셈 (음수는 0)
+constexpr uint32_t sub_sat_u8(uint32_t a, uint32_t b) {
+    uint32_t diff = ((a | HI_8) - (b & LO7_8)) ^ ((a ^ ~b) & HI_8);   // 레인별 wrap 뺄셈
+    uint32_t borrow = ((~a & b) | (~(a ^ b) & diff)) & HI_8;
+    return diff & ~expand8(borrow);
+}
+
+/// @brief 16비트 레인별 부호 없는 포화 덧셈
+constexpr uint32_t add_sat_u16(uint32_t a, uint32_t b) {
+    uint32_t sum = ((a & LO15_16) + (b & LO15_16)) ^ ((a ^ b) & HI_16);
+    uint32_t carry = ((a & b) | ((a | b) & ~sum)) & HI_16;
+    return sum | expand16(carry);
+}
+
+/// @brief 16비트 레인별 부호 없는 포화 뺄셈 (음수는 0)
+constexpr uint32_t sub_sat_u16(uint32_t a, uint32_t b) {
+    uint32_t diff = ((a | HI_16) - (b & LO15_16)) ^ ((a ^ ~b) & HI_16);
+    uint32_t borrow = ((~a & b) | (~(a ^ b) & diff)) & HI_16;
+    return diff & ~expand16(borrow);
+}
+
+/// @brief 8비트 레인별 a == b 이면 0xFF, 아니면 0x00
+constexpr uint32_t cmp_eq_u8(uint32_t a, uint32_t b) {
+    uint32_t t = a ^ b;
+    uint32_t nonzero = (((t & LO7_8) + LO7_8) | t) & HI_8;
+    return expand8(~nonzero & HI_8);
+}
+
+/// @brief 8비트 레인별 a > b (부호 없음) 이면 0xFF, 아니면 0x00
+constexpr uint32_t cmp_gt_u8(uint32_t a, uint32_t b) {
+    // b - a에서 borrow가 나는 레인이 a > b
+    uint32_t diff = ((b | HI_8) - (a & LO7_8)) ^ ((b ^ ~a) & HI_8);
+    return expand8(((~b & a) | (~(a ^ b) & diff)) & HI_8);
+}
+
+/// @brief 16비트 레인별 a == b 이면 0xFFFF, 아니면 0x0000
+constexpr uint32_t cmp_eq_u16(uint32_t a, uint32_t b) {
+    uint32_t t = a ^ b;
+    uint32_t nonzero = (((t & LO15_16) + LO15_16) | t) & HI_16;
+    return expand16(~nonzero & HI_16);
+}
+
+/// @brief 16비트 레인별 a > b (부호 없음) 이면 0xFFFF, 아니면 0x0000
+constexpr uint32_t cmp_gt_u16(uint32_t a, uint32_t b) {
+    uint32_t diff = ((b | HI_16) - (a & LO15_16)) ^ ((b ^ ~a) & HI_16);
+    return expand16(((~b & a) | (~(a ^ b) & diff)) & HI_16);
+}
+
+/**
+ * @brief 8비트 레인 재배치: 결과 레인 i = a의 레인 ((selector >> 2i) & 3)
+ * 예) selector 0x1B = 바이트 순서 뒤집기, 0x00 = 레인 0을 4개 레인에 복제
+ */
+constexpr uint32_t shuffle_u8(uint32_t a, uint8_t selector) {
+    uint32_t out = 0;
+    for (unsigned lane = 0; lane < 4; ++lane) {
+        unsigned src = (selector >> (lane * 2)) & 3u;
+        out |= ((a >> (src * 8)) & 0xFFu) << (lane * 8);
+    }
+    return out;
+}
+
+/// @brief 8비트 레인별 1비트 개수 (각 레인 결과 0~8)
+constexpr uint32_t popcount_u8(uint32_t a) {
+    a = a - ((a >> 1) & 0x55555555u);
+    a = (a & 0x33333333u) + ((a >> 2) & 0x33333333u);
+    return (a + (a >> 4)) & 0x0F0F0F0Fu;
+}
+
+} // namespace swar
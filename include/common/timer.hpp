@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief std::chrono::steady_clock 기반 타이머
+ * SDL 초기화와 무관하게 동작하므로 헤드리스 실행에서도 그대로 쓸 수 있다.
+ * 시각과 마감 시한은 모두 나노초 단위 (임의의 기준점에서 단조 증가).
+ */
+namespace timer {
+    constexpr uint64_t NS_PER_MS = 1000000;
+    constexpr uint64_t NS_PER_SECOND = 1000000000;
+
+    uint64_t now_ns();
+
+    // 기존 밀리초 API (now_ns / sleep_until_ns 위에 구현)
+    uint32_t get_ticks();
+    void delay(uint32_t ms);
+
+    /**
+     * @brief deadline까지 대기: 남은 시간이 길면 OS sleep으로 대부분을 보내고
+     * 마지막 구간(SPIN_THRESHOLD_NS)만 yield하며 돌아서 정확도를 맞춘다.
+     * @return 실제로 깨어난 시각
+     */
+    uint64_t sleep_until_ns(uint64_t deadline);
+
+    constexpr uint64_t SPIN_THRESHOLD_NS = 2 * NS_PER_MS;  // OS sleep 오차(보통 1ms 안팎)보다 크게
+
+    /**
+     * @brief 프레임 간격 지터 통계 (목표 시각 대비 실제로 깨어난 시각의 차이)
+     */
+    struct JitterStats {
+        uint64_t frames = 0;        // 측정한 프레임 수
+        uint64_t late_frames = 0;   // 한 주기 이상 밀려서 기준 시각을 다시 잡은 횟수
+        int64_t max_ns = 0;         // 가장 늦게 깨어난 정도
+        int64_t min_ns = 0;         // 가장 적게 늦은 정도
+        double mean_abs_ns = 0.0;   // |지터| 평균
+
+        void record(int64_t jitter_ns);
+    };
+
+    /**
+     * @brief 고정 주기 프레임 페이서 (예: 60Hz = 16,666,667ns)
+     * 마감 시한을 절대 시각으로 누적하므로 sleep 오차가 프레임마다 쌓이지 않는다.
+     * 한 주기 이상 밀리면(디버거 정지, 창 이동 등) 따라잡으려 몰아 실행하지 않고 기준을 현재로 옮긴다.
+     */
+    class FramePacer {
+    public:
+        explicit FramePacer(uint64_t period_ns);
+
+        /// @brief 다음 프레임 시각까지 대기
+        void wait();
+
+        /// @brief 기준 시각을 현재로 다시 잡음 (일시 정지 후 재개 등)
+        void restart();
+
+        uint64_t period_ns() const { return period_ns_; }
+        const JitterStats& stats() const { return stats_; }
+
+    private:
+        uint64_t period_ns_;
+        uint64_t deadline_;
+        JitterStats stats_;
+    };
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @brief 단일 생산자 / 단일 소비자 lock-free 삼중 버퍼
+ *
+ * 생산자는 back 버퍼에 쓰고 publish()로 middle과 교환하며, 소비자는 update()로
+ * 새 middle이 있을 때만 front와 교환한다. 양쪽 모두 대기하지 않고,
+ * 소비자가 느리면 중간 프레임은 덮어써져 항상 가장 최근 완성본만 읽는다.
+ */
+template <typename T>
+class TripleBuffer {
+public:
+    /// @brief 생산자가 다음 내용을 쓸 버퍼
+    T& write_buffer() { return buffers_[back_]; }
+
+    /// @brief 다 쓴 back 버퍼를 소비자에게 공개
+    void publish() {
+        uint8_t previous = middle_.exchange(static_cast<uint8_t>(back_ | DIRTY), std::memory_order_acq_rel);
+        back_ = previous & INDEX_MASK;
+    }
+
+    /// @brief 공개한 버퍼를 소비자가 아직 가져가지 않았는지 (생산자가 프레임을 건너뛸지 판단)
+    bool pending() const {
+        return middle_.load(std::memory_order_acquire) & DIRTY;
+    }
+
+    /// @brief 새로 공개된 버퍼가 있으면 front로 가져오고 true
+    bool update() {
+        if (!(middle_.load(std::memory_order_relaxed) & DIRTY)) return false;
+        uint8_t previous = middle_.exchange(front_, std::memory_order_acq_rel);
+        front_ = previous & INDEX_MASK;
+        return true;
+    }
+
+    /// @brief 소비자가 읽는 가장 최근 버퍼
+    const T& read_buffer() const { return buffers_[front_]; }
+
+private:
+    static constexpr uint8_t INDEX_MASK = 0x3;
+    static constexpr uint8_t DIRTY = 0x4;   // middle에 아직 읽지 않은 새 내용이 있음
+
+    std::array<T, 3> buffers_{};
+    uint8_t back_ = 0;                      // 생산자 전용
+    uint8_t front_ = 1;                     // 소비자 전용
+    std::atomic<uint8_t> middle_{2};
+};
@@ -3,100 +3,108 @@
 #include <array>
 #include <cstdint>
 #include "common/constants.hpp"
+#include "machine_core.hpp"
+#include "dialect.hpp"
+#include "quirks.hpp"
+#include "opcode_table.hpp"
 
 // CHIP-8은 4KB 메모리를 사용합니다.
 constexpr unsigned int MEMORY_SIZE = 4096;
 
+// XO-CHIP은 64KB 메모리를 사용합니다. (메모리 배열은 항상 이 크기로 잡고 방언에 따라 사용 범위만 제한)
+constexpr unsigned int MEMORY_SIZE_XO = 65536;
+
+// 폰트 위치: 작은 폰트(4x5) 0x000~0x04F, SUPER-CHIP 큰 폰트(8x10) 0x050~0x0EF
+constexpr unsigned int FONT_ADDRESS = 0x000;
+constexpr unsigned int BIG_FONT_ADDRESS = 0x050;
+
+// SUPER-CHIP RPL 사용자 플래그 수 (XO-CHIP은 16개 모두 사용)
+constexpr unsigned int NUM_RPL_FLAGS = 16;
+
+// XO-CHIP 오디오 패턴 버퍼 크기 (1비트 샘플 128개)
+constexpr unsigned int AUDIO_PATTERN_SIZE = 16;
+
 // CHIP-8은 16개의 8비트 레지스터(V0~VF)를 사용합니다.
 constexpr unsigned int NUM_REGISTERS = 16;
 
 // CHIP-8은 최대 16단계의 서브루틴 호출 스택을 가집니다.
 constexpr unsigned int STACK_SIZE = 16;
 
-class Chip8 {
+// 8비트 코어의 머신 크기 (MachineCore 인자)
+struct Chip8Traits {
+    using Register = uint8_t;
+    using Address = uint16_t;
+    using Opcode = uint16_t;
+    static constexpr unsigned int REGISTERS = NUM_REGISTERS;
+    static constexpr unsigned int STACK = STACK_SIZE;
+    static constexpr unsigned int MEMORY = MEMORY_SIZE_XO;   // 메모리 배열은 항상 64KB, 방언에 따라 사용 범위만 제한
+    static constexpr unsigned int VIDEO = VIDEO_WIDTH_HI * VIDEO_HEIGHT_HI;
+    static constexpr unsigned int INSTRUCTION_SIZE = 2;
+    static constexpr const char* NAME = "8-bit CHIP-8";
+};
+
+class Chip8 : public MachineCore<Chip8, Chip8Traits> {
 public:
     Chip8(); // 생성자: 초기화 수행
 
-    bool draw_flag; // 화면을 다시 그려야 하는 경우 true로 설정
-
     void reset();
-    bool load_rom(const char* filename); // ROM 파일을 메모리에 로드
     void cycle(); // Fetch - Decode - Execute 수행 (CPU 한 사이클)
 
-    bool needs_redraw() const; // 화면 출력이 필요한지 여부를 반환하는 함수        
-    void clear_draw_flag(); // 화면 갱신 플래그를 false로 초기화          
-    const uint8_t* get_video_buffer() const; // 비디오 버퍼에 대한 포인터를 반환 
-    uint8_t* get_keypad(); // 키보드 상태 배열에 대한 포인터를 반환           
-
-    // 외부에서 키 입력 및 디스플레이 버퍼 접근을 위해 공개
-    std::array<uint8_t, NUM_KEYS> keypad;        // 키 상태 배열
-    std::array<uint8_t, VIDEO_WIDTH * VIDEO_HEIGHT> video; // 화면 버퍼
-
-    std::array<uint8_t, VIDEO_WIDTH * VIDEO_HEIGHT>& get_video();
-    
-    // 공개 타이머 값 (SDL에서 비프음 등을 처리할 수 있도록)
-    uint8_t delay_timer;
-    uint8_t sound_timer;
+    // 방언 선택 (디스패치 테이블과 메모리 크기가 바뀌므로 ROM 로드 전에 호출, 내부에서 reset, quirk 설정은 유지)
+    void set_dialect(Dialect dialect);
+    Dialect get_dialect() const { return dialect_; }
 
-    // 프로그램 카운터
-    uint16_t get_pc() const { return pc; }
-    void set_pc(uint16_t value) { pc = value; }
-
-    // V 레지스터 접근
-    uint8_t get_V(int index) const { return V.at(index); }
-    void set_V(int index, uint8_t value) { V.at(index) = value; }
-
-    // 메모리 접근
-    uint8_t get_memory(int index) const { return memory.at(index); }
-    void set_memory(int index, uint8_t value) { memory.at(index) = value; }
+    // 동작 차이 (ROM 프로필 / --quirks, 방언과 마찬가지로 reset에도 유지)
+    // 조합에 맞게 특수화된 디스패치 테이블로 바꾼다 (실행 중 quirk 검사 없음)
+    void set_quirks(const Quirks& quirks) {
+        quirks_ = quirks;
+        dispatch_ = &OpcodeTable::Table(dialect_, quirks_);
+    }
+    const Quirks& quirks() const { return quirks_; }
+    const OpcodeTable::DispatchTable& dispatch_table() const { return *dispatch_; }
 
-    // 인덱스 레지스터 I
-    uint16_t get_I() const { return I; }
-    void set_I(uint16_t value) { I = value; }
+    // 해상도 (00FE 저해상도 64x32 / 00FF 고해상도 128x64, 전환 시 화면을 지움)
+    // 화면 버퍼 픽셀 바이트의 비트 0 = 평면 1, 비트 1 = 평면 2 (XO-CHIP 외에는 평면 1만 사용)
+    void set_hires(bool enable);
+    bool is_hires() const { return video_width_ == VIDEO_WIDTH_HI; }
 
-    // 스택
-    uint16_t get_stack(int index) const { return stack.at(index); }
-    void set_stack(int index, uint16_t value) { stack.at(index) = value; }
+    // 선택된 평면의 픽셀만 스크롤 (양수 dx = 오른쪽, 양수 dy = 아래쪽, 빈 자리는 0)
+    void scroll(int dx, int dy);
 
-    // 스택 포인터
-    uint8_t get_sp() const { return sp; }
-    void set_sp(uint8_t value) { sp = value; }
+    // XO-CHIP 비트플레인 선택 마스크 (FN01, 기본값 1)
+    uint8_t get_planes() const { return planes_; }
+    void set_planes(uint8_t mask) { planes_ = mask & 0x3; }
 
-    // 비디오 메모리
-    uint8_t get_video(int index) const { return video.at(index); }
-    void set_video(int index, uint8_t value) { video.at(index) = value; }
+    // SUPER-CHIP RPL 사용자 플래그 (FX75 / FX85)
+    uint8_t get_rpl(int index) const { return rpl_.at(index); }
+    void set_rpl(int index, uint8_t value) { rpl_.at(index) = value; }
 
-    // 키보드
-    uint8_t get_key(int index) const { return keypad.at(index); }
-    void set_key(int index, uint8_t value) { keypad.at(index) = value; }
+    // XO-CHIP 오디오 패턴 (F002) 과 피치 (FX3A)
+    const std::array<uint8_t, AUDIO_PATTERN_SIZE>& get_audio_pattern() const { return audio_pattern_; }
+    void set_audio_pattern(int index, uint8_t value) { audio_pattern_.at(index) = value; }
+    uint8_t get_audio_pitch() const { return audio_pitch_; }
+    void set_audio_pitch(uint8_t value) { audio_pitch_ = value; }
 
-    // 사운드 타이머
-    uint8_t get_sound_timer() const { return sound_timer; }
-    void set_sound_timer(uint8_t value) { sound_timer = value; }
+    // 재생할 소리 (XO-CHIP만 오디오 패턴, 그 외 방언은 기본 비프음)
+    const uint8_t* sound_pattern() const { return dialect_ == Dialect::XoChip ? audio_pattern_.data() : nullptr; }
+    uint8_t sound_pitch() const { return audio_pitch_; }
 
-    // 딜레이 타이머
-    uint8_t get_delay_timer() const { return delay_timer; }
-    void set_delay_timer(uint8_t value) { delay_timer = value; }
+    // 난수 (CXNN)
+    uint8_t random_byte() { return static_cast<uint8_t>(rng_.next() >> 24); }
 
-    // 드로우 플래그
-    bool get_draw_flag() const { return draw_flag; }
-    void set_draw_flag(bool value) { draw_flag = value; }
+    // V 레지스터 접근
+    uint8_t get_V(int index) const { return get_register(index); }
+    void set_V(int index, uint8_t value) { set_register(index, value); }
 
-    uint16_t& stack_at(uint8_t index); // 참조 리턴
-    uint32_t getCurrentOpcode() const {
-        return static_cast<uint32_t>(opcode);  // current_opcode → opcode로 변경
-    }
 private:
-    std::array<uint8_t, MEMORY_SIZE> memory;     // 4KB 메모리
-    std::array<uint8_t, NUM_REGISTERS> V;        // 범용 레지스터 V0~VF
-    uint16_t I;                                  // 인덱스 레지스터 (메모리 주소)
-    uint16_t pc;                                 // 프로그램 카운터
-
-    std::array<uint16_t, STACK_SIZE> stack;      // 스택 (CALL/RET 용)
-    uint8_t sp;                                  // 스택 포인터
+    // 방언 (set_dialect에서만 바뀌고 reset에도 유지)
+    Dialect dialect_ = Dialect::Chip8;
+    Quirks quirks_;
+    const OpcodeTable::DispatchTable* dispatch_ = &OpcodeTable::Table(Dialect::Chip8);
 
-    uint16_t opcode;                             // 현재 실행 중인 명령어 (2바이트)
+    uint8_t planes_ = 1;
 
-    // 내부 함수: opcode 처리기 (Cycle 내부에서 호출)
-    void ExecuteOpcode(uint16_t opcode);
-};
\ No newline at end of file
+    std::array<uint8_t, NUM_RPL_FLAGS> rpl_{};
+    std::array<uint8_t, AUDIO_PATTERN_SIZE> audio_pattern_{};
+    uint8_t audio_pitch_ = 64;                   // XO-CHIP 기본 피치 (4000Hz 재생 속도)
+};
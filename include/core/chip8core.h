@@ -0,0 +1,130 @@
+/* include/core/chip8core.h */
+#ifndef CHIP8CORE_H
+#define CHIP8CORE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * chip8core C API
+ *
+ * SDL, 창, 오디오, 전역 실행 설정 없이 에뮬레이터 코어만 쓰기 위한 C ABI (libchip8core.a / libchip8core.so).
+ * 인스턴스끼리 공유하는 것은 첫 chip8core_create에서 한 번 채우는 읽기 전용 디스패치 테이블뿐이고,
+ * 라이브러리는 스레드를 만들지 않으며 로그도 인스턴스별 콜백으로만 나간다 (chip8core_set_log_callback).
+ * 따라서 인스턴스마다 다른 스레드에서 돌려도 된다 (한 인스턴스를 여러 스레드에서 동시에 호출하지는 말 것).
+ *
+ *   chip8core* core = chip8core_create(CHIP8CORE_KIND_CHIP8);
+ *   chip8core_load_rom(core, rom, rom_size);
+ *   while (running) {
+ *       chip8core_set_key(core, key, pressed);
+ *       chip8core_run(core, ipf);          // 한 프레임 분량
+ *       chip8core_tick_timers(core);       // 60Hz
+ *       draw(chip8core_framebuffer(core, &w, &h));
+ *   }
+ *   chip8core_destroy(core);
+ *
+ * 화면 버퍼는 픽셀당 1바이트 (0 = 꺼짐, 비트 0/1 = XO-CHIP 평면 1/2), 행 우선 width x height.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct chip8core chip8core;
+typedef struct chip8core_snapshot chip8core_snapshot;
+
+/* 코어 종류 */
+#define CHIP8CORE_KIND_CHIP8     0  /* 8비트 CHIP-8 (방언은 chip8core_set_dialect) */
+#define CHIP8CORE_KIND_CHIP8_32  1  /* 32비트 확장 코어 */
+
+/* 8비트 방언 */
+#define CHIP8CORE_DIALECT_CHIP8      0
+#define CHIP8CORE_DIALECT_SUPERCHIP  1
+#define CHIP8CORE_DIALECT_XOCHIP     2
+
+/* 8비트 동작 차이 (비트 OR) */
+#define CHIP8CORE_QUIRK_SHIFT     (1u << 0)  /* 8XY6/8XYE가 Vy를 시프트 */
+#define CHIP8CORE_QUIRK_MEMORY    (1u << 1)  /* FX55/FX65 후 I += X + 1 */
+#define CHIP8CORE_QUIRK_VF_RESET  (1u << 2)  /* 8XY1/2/3 후 VF = 0 */
+#define CHIP8CORE_QUIRK_CLIP      (1u << 3)  /* 스프라이트를 화면 끝에서 자름 */
+#define CHIP8CORE_QUIRK_JUMP      (1u << 4)  /* BXNN = XNN + Vx */
+
+/* 결과 코드 */
+#define CHIP8CORE_OK                0
+#define CHIP8CORE_ERROR_EMPTY       4   /* 빈 ROM */
+#define CHIP8CORE_ERROR_TOO_LARGE   5   /* 프로그램 영역보다 큰 ROM */
+#define CHIP8CORE_ERROR_ARGUMENT    16  /* 잘못된 인자 (NULL, 범위 밖 값, 다른 코어의 스냅샷) */
+
+/* 로그 레벨 (chip8core_set_log_callback) */
+#define CHIP8CORE_LOG_TRACE  0
+#define CHIP8CORE_LOG_DEBUG  1
+#define CHIP8CORE_LOG_INFO   2
+#define CHIP8CORE_LOG_WARN   3
+#define CHIP8CORE_LOG_ERROR  4
+#define CHIP8CORE_LOG_OFF    5
+
+/* 코어 생성 (kind가 잘못되면 NULL) / 해제 */
+chip8core* chip8core_create(int kind);
+void chip8core_destroy(chip8core* core);
+
+/* 코어 종류 (CHIP8CORE_KIND_*) */
+int chip8core_kind(const chip8core* core);
+
+/* 8비트 방언 선택 (메모리가 초기화되므로 ROM 로드 전에 호출, 32비트 코어면 CHIP8CORE_ERROR_ARGUMENT) */
+int chip8core_set_dialect(chip8core* core, int dialect);
+
+/* 8비트 동작 차이 (CHIP8CORE_QUIRK_* 조합) */
+int chip8core_set_quirks(chip8core* core, unsigned int quirks);
+
+/* 난수 시드 (reset에도 유지) */
+void chip8core_set_seed(chip8core* core, uint32_t seed);
+
+/* 메모리의 ROM 이미지를 0x200부터 로드 (헤더가 있으면 호출 전에 제거) */
+int chip8core_load_rom(chip8core* core, const uint8_t* data, size_t size);
+
+/* 초기 상태로 리셋 (로드한 ROM도 지워짐, 방언/quirk/시드는 유지) */
+void chip8core_reset(chip8core* core);
+
+/*
+ * 명령어를 최대 cycles개 실행하고 실제 실행한 수를 돌려준다.
+ * 실행이 끝난 상태(00FD, 잘못된 분기, 메모리 범위 밖 접근)가 되면 멈추며 chip8core_is_halted가 1이 된다.
+ */
+uint32_t chip8core_run(chip8core* core, uint32_t cycles);
+
+/* 지연/사운드 타이머 1 감소 (60Hz로 호출) */
+void chip8core_tick_timers(chip8core* core);
+
+int chip8core_is_halted(const chip8core* core);
+
+/* 사운드 타이머가 켜져 있으면 1 */
+int chip8core_sound_active(const chip8core* core);
+
+/* 현재 해상도의 화면 버퍼 (포인터는 destroy까지 유효하지만 해상도는 실행 중 바뀔 수 있음, width/height는 NULL 가능) */
+const uint8_t* chip8core_framebuffer(const chip8core* core, unsigned int* width, unsigned int* height);
+
+/* 마지막으로 플래그를 지운 뒤 화면이 바뀌었으면 1 (clear가 0이 아니면 플래그를 지움) */
+int chip8core_frame_changed(chip8core* core, int clear);
+
+/* 키패드 키 (0x0 ~ 0xF) 눌림/뗌 */
+int chip8core_set_key(chip8core* core, unsigned int key, int pressed);
+
+/* 스냅샷: 코어 전체 상태 복사본 (같은 종류의 코어에만 복원 가능) */
+chip8core_snapshot* chip8core_snapshot_create(const chip8core* core);
+int chip8core_snapshot_restore(chip8core* core, const chip8core_snapshot* snapshot);
+void chip8core_snapshot_destroy(chip8core_snapshot* snapshot);
+
+/* 로그 메시지를 받는 함수 (category는 "cpu8", "video" 등, message는 호출 동안만 유효) */
+typedef void (*chip8core_log_fn)(void* user, int level, const char* category, const char* message);
+
+/*
+ * 이 인스턴스의 진단 메시지를 받을 콜백 (기본값 NULL: 버림).
+ * min_level 미만 메시지는 거르며, 콜백은 해당 chip8core_* 호출 안에서 같은 스레드로 불린다.
+ * (빌드 설정 CHIP8_LOG_LEVEL 미만 레벨은 컴파일 단계에서 빠져 있음)
+ */
+int chip8core_set_log_callback(chip8core* core, chip8core_log_fn callback, void* user, int min_level);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHIP8CORE_H */
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief 명령어 실행 직전의 디버거 검사 지점
+ * 코어는 디버거 타입을 모르므로 검사할 PC의 비트맵(브레이크포인트 주소)과 콜백만 받는다.
+ * 명령어 루프는 pc_mask[pc]가 켜져 있거나 워치포인트 히트가 쌓였을 때만 콜백을 부르고,
+ * 콜백이 true를 돌려주면 그 명령어를 실행하지 않고 묶음을 끝낸다.
+ * 연결된 훅이 없으면 명령어마다 포인터 검사 한 번으로 끝난다.
+ */
+struct DebugHook {
+    const std::vector<bool>* pc_mask = nullptr;      // 콜백을 부를 PC (nullptr이면 워치포인트 히트만)
+    bool (*callback)(void* user, uint32_t pc) = nullptr;
+    void* user = nullptr;
+};
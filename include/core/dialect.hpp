@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief 8비트 코어가 해석하는 CHIP-8 방언
+ * 방언마다 별도의 디스패치 테이블이 있고, 코어는 ROM 로드 전에 한 번 테이블을 고른다.
+ */
+enum class Dialect : uint8_t {
+    Chip8,      // 원본 COSMAC VIP 명령어 세트
+    SuperChip,  // SUPER-CHIP 1.1: 128x64 고해상도, 스크롤, 16x16 스프라이트, 큰 폰트, RPL 플래그
+    XoChip,     // XO-CHIP: SUPER-CHIP + 64KB 메모리, 비트플레인 2장, F000 NNNN, 오디오 패턴
+    Count
+};
+
+constexpr unsigned int NUM_DIALECTS = static_cast<unsigned int>(Dialect::Count);
+
+/// @brief "chip8", "schip", "xochip" 파싱
+inline bool parse_dialect(const std::string& text, Dialect& dialect) {
+    if (text == "chip8") dialect = Dialect::Chip8;
+    else if (text == "schip" || text == "superchip") dialect = Dialect::SuperChip;
+    else if (text == "xochip" || text == "xo-chip") dialect = Dialect::XoChip;
+    else return false;
+    return true;
+}
+
+inline const char* dialect_name(Dialect dialect) {
+    switch (dialect) {
+        case Dialect::Chip8:     return "CHIP-8";
+        case Dialect::SuperChip: return "SUPER-CHIP";
+        case Dialect::XoChip:    return "XO-CHIP";
+        default:                 return "?";
+    }
+}
+
+/// @brief parse_dialect가 받는 이름 ("chip8", "schip", "xochip")
+inline const char* dialect_key(Dialect dialect) {
+    switch (dialect) {
+        case Dialect::Chip8:     return "chip8";
+        case Dialect::SuperChip: return "schip";
+        case Dialect::XoChip:    return "xochip";
+        default:                 return "?";
+    }
+}
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include "common/constants.hpp"
+#include "common/frame.hpp"
+#include "common/input.hpp"
+#include "common/rom_loader.hpp"
+
+/// @brief 머신 실행 통계 (호스트 루프 종료 시 출력)
+struct MachineStats {
+    uint64_t instructions = 0;   // 실행한 명령어 수
+    uint64_t batches = 0;        // run_batch 호출 수 (보통 프레임 수)
+};
+
+/// @brief 프레임 끝의 소리 상태 (pattern이 nullptr이면 기본 비프음)
+struct MachineSound {
+    bool active = false;               // 사운드 타이머 > 0
+    const uint8_t* pattern = nullptr;  // XO-CHIP 오디오 패턴 (16바이트)
+    uint8_t pitch = 64;
+};
+
+/**
+ * @brief 호스트가 보는 머신 (코어 종류와 무관한 다형 인터페이스)
+ *
+ * 호스트 루프(창, 헤드리스, 캡처 등)는 이 인터페이스만 사용하므로 두 ISA에 그대로 쓰인다.
+ * 가상 호출은 명령어 묶음(run_batch) 단위로 한 번이며, 묶음 안의 명령어 루프는
+ * CoreMachine<Core>에서 코어의 cycle()을 정적으로 호출한다.
+ */
+class Machine {
+public:
+    virtual ~Machine() = default;
+
+    /// @brief 로그/창 제목용 이름
+    virtual const char* name() const = 0;
+
+    /// @brief 프로그램 바이트를 0x200부터 로드
+    virtual RomError load(const uint8_t* data, std::size_t size) = 0;
+
+    /**
+     * @brief 명령어를 최대 count개 실행 (멈춘 상태가 되면 중단)
+     * input의 이벤트는 예약된 명령어 위치에서 반영하고, 끝나면 남은 이벤트를 모두 반영한다.
+     * 명령어가 예외(메모리 범위 밖 접근)를 던져도 그 전까지 실행한 수는 stats()에 반영된다.
+     * 코어에 연결된 디버거 훅(DebugHook)이 멈추라고 하면 그 명령어 앞에서 끝난다.
+     * @return 실제 실행한 명령어 수
+     */
+    virtual unsigned int run_batch(unsigned int count, InputScheduler& input) = 0;
+
+    /// @brief 60Hz 타이머 감소 (프레임마다 한 번)
+    virtual void tick_timers() = 0;
+
+    virtual bool is_halted() const = 0;
+    virtual void halt() = 0;
+
+    // 화면 (현재 해상도 뷰, 갱신 플래그)
+    virtual FrameView frame() const = 0;
+    virtual bool needs_redraw() const = 0;
+    virtual void clear_draw_flag() = 0;
+
+    /// @brief 키패드 상태 (직접 눌림/뗌을 넣을 때)
+    virtual std::array<uint8_t, NUM_KEYS>& keypad() = 0;
+
+    virtual MachineSound sound() const = 0;
+
+    /// @brief 마지막으로 실행한 명령어 (디버거 출력용)
+    virtual uint32_t current_opcode() const = 0;
+
+    /// @brief 현재 상태의 복사본 / 같은 종류 머신의 스냅샷으로 복원 (다른 종류면 false)
+    virtual std::unique_ptr<Machine> snapshot() const = 0;
+    virtual bool restore(const Machine& state) = 0;
+
+    const MachineStats& stats() const { return stats_; }
+
+protected:
+    MachineStats stats_;
+};
+
+/**
+ * @brief MachineCore 기반 코어(Chip8, Chip8_32)를 Machine으로 감싼 어댑터
+ * 코어 고유 설정(방언, quirk, 디버거 연결)은 core()로 직접 한다.
+ */
+template <typename Core>
+class CoreMachine final : public Machine {
+public:
+    explicit CoreMachine(const char* name) : name_(name) {}
+
+    Core& core() { return core_; }
+    const Core& core() const { return core_; }
+
+    const char* name() const override { return name_; }
+
+    RomError load(const uint8_t* data, std::size_t size) override { return core_.load_rom_data(data, size); }
+
+    unsigned int run_batch(unsigned int count, InputScheduler& input) override {
+        unsigned int executed = 0;
+        // 예외로 빠져나가도 통계가 남도록 소멸자에서 반영
+        struct Tally {
+            MachineStats& stats;
+            const unsigned int& executed;
+            ~Tally() {
+                stats.instructions += executed;
+                ++stats.batches;
+            }
+        } tally{stats_, executed};
+
+        while (executed < count && !core_.is_halted()) {
+            if (core_.debug_break()) break;
+            input.apply(executed, core_.keypad);
+            core_.cycle();
+            ++executed;
+        }
+        input.finish(core_.keypad);
+        return executed;
+    }
+
+    void tick_timers() override { core_.tick_timers(); }
+    bool is_halted() const override { return core_.is_halted(); }
+    void halt() override { core_.halt(); }
+
+    FrameView frame() const override { return core_.frame(); }
+    bool needs_redraw() const override { return core_.needs_redraw(); }
+    void clear_draw_flag() override { core_.clear_draw_flag(); }
+
+    std::array<uint8_t, NUM_KEYS>& keypad() override { return core_.keypad; }
+
+    MachineSound sound() const override {
+        return {core_.sound_timer > 0, core_.sound_pattern(), core_.sound_pitch()};
+    }
+
+    uint32_t current_opcode() const override { return core_.getCurrentOpcode(); }
+
+    std::unique_ptr<Machine> snapshot() const override { return std::make_unique<CoreMachine>(*this); }
+
+    bool restore(const Machine& state) override {
+        const auto* other = dynamic_cast<const CoreMachine*>(&state);
+        if (!other) return false;
+        core_.restore(other->core_);
+        stats_ = other->stats_;
+        return true;
+    }
+
+private:
+    const char* name_;
+    Core core_;
+};
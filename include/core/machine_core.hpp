@@ -0,0 +1,301 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include "common/constants.hpp"
+#include "common/frame.hpp"
+#include "common/log.hpp"
+#include "common/rng.hpp"
+#include "common/rom_loader.hpp"
+#include "debug_hook.hpp"
+#include "memory_watch.hpp"
+
+// 프로그램 시작 주소 (ROM은 여기부터 로드, 두 코어 공통)
+constexpr unsigned int PROGRAM_START = 0x200;
+
+/**
+ * @brief 8비트 / 32비트 코어가 공유하는 머신 상태와 공통 동작
+ *
+ * Derived는 CRTP로 넘긴 실제 코어(Chip8, Chip8_32)이고, Traits는 ISA별 크기를 정한다.
+ *   - Register / Address / Opcode : 레지스터, 주소(PC/I/스택), 명령어 워드 타입
+ *   - REGISTERS / STACK           : 레지스터 수, 스택 깊이
+ *   - MEMORY                      : 메모리 배열 크기 (워치포인트 페이지 단위의 배수)
+ *   - VIDEO                       : 화면 버퍼 크기 (최대 해상도로 고정 할당)
+ *   - INSTRUCTION_SIZE            : 명령어 길이 (바이트)
+ *   - NAME                        : 로그용 이름
+ *
+ * 메모리/타이머/화면 버퍼/ROM 로드/스냅샷/명령어 묶음 실행은 여기서 한 번만 구현하고,
+ * fetch와 디스패치(명령어 인코딩이 다름)와 방언/화면 모드 같은 ISA 고유 기능만 Derived에 둔다.
+ * 모든 호출은 컴파일 타임에 결정되며 가상 함수는 없다.
+ */
+template <typename Derived, typename Traits>
+class MachineCore {
+public:
+    using Register = typename Traits::Register;
+    using Address = typename Traits::Address;
+    using Opcode = typename Traits::Opcode;
+    using VideoBuffer = std::array<uint8_t, Traits::VIDEO>;
+
+    static constexpr unsigned int MEMORY_CAPACITY = Traits::MEMORY;
+    static constexpr unsigned int INSTRUCTION_SIZE = Traits::INSTRUCTION_SIZE;
+    static constexpr unsigned int REGISTER_COUNT = Traits::REGISTERS;
+    static constexpr unsigned int STACK_DEPTH = Traits::STACK;
+
+    bool draw_flag = false; // 화면을 다시 그려야 하는 경우 true로 설정
+
+    // 외부에서 키 입력 및 디스플레이 버퍼 접근을 위해 공개
+    std::array<uint8_t, NUM_KEYS> keypad{};      // 키 상태 배열
+    VideoBuffer video{};                         // 화면 버퍼 (앞쪽 video_width() x video_height()만 사용)
+
+    // 공개 타이머 값 (SDL에서 비프음 등을 처리할 수 있도록)
+    uint8_t delay_timer = 0;
+    uint8_t sound_timer = 0;
+
+    // ROM 파일을 0x200부터 로드 (파일은 읽기 전용으로 매핑한 뒤 한 번에 복사, 실패 원인을 돌려줌)
+    RomError load_rom(const char* filename) {
+        RomImage rom;
+        RomError error = rom.open(filename, program_capacity());
+        if (error != RomError::None) {
+            LOG_ERROR(General, "Cannot load ROM %s for %s: %s", filename, Traits::NAME, rom_error_message(error));
+            return error;
+        }
+        return load_rom_data(rom.data(), rom.size());
+    }
+
+    // 메모리의 ROM 이미지를 0x200부터 복사 (현재 메모리 크기의 프로그램 영역으로 검사)
+    RomError load_rom_data(const uint8_t* data, std::size_t size) {
+        if (size == 0) return RomError::Empty;
+        if (size > program_capacity()) {
+            LOG_ERROR(General, "ROM too large for %s: %zu bytes (max %zu)", Traits::NAME, size, program_capacity());
+            return RomError::TooLarge;
+        }
+        std::memcpy(memory.data() + PROGRAM_START, data, size);
+        loaded_rom_size_ = size;
+        return RomError::None;
+    }
+    std::size_t loaded_rom_size() const { return loaded_rom_size_; }
+
+    // 명령어를 최대 count개 실행 (멈춘 상태가 되면 중단), 실제 실행한 수를 돌려줌
+    // Derived::cycle이 인라인되므로 호스트 루프는 프레임마다 이 함수만 부르면 된다.
+    unsigned int run(unsigned int count) {
+        unsigned int executed = 0;
+        while (executed < count && !halted_) {
+            if (debug_break()) break;
+            derived().cycle();
+            ++executed;
+        }
+        return executed;
+    }
+
+    // 60Hz 타이머 감소 (명령어 실행 속도와 무관하게 프레임마다 한 번)
+    void tick_timers() {
+        if (delay_timer > 0) --delay_timer;
+        if (sound_timer > 0) --sound_timer;
+    }
+
+    // 사운드 타이머가 켜져 있을 때 재생할 패턴 (nullptr = 기본 비프음, 패턴이 있는 코어가 다시 정의)
+    const uint8_t* sound_pattern() const { return nullptr; }
+    uint8_t sound_pitch() const { return 64; }
+
+    // 실행이 끝난 상태 (8비트 00FD, 32비트 잘못된 분기)
+    bool is_halted() const { return halted_; }
+    void halt() { halted_ = true; }
+
+    // 디버거 검사 지점 연결 / 해제 (기본값 DebugHook{}: 연결 없음)
+    void set_debug_hook(const DebugHook& hook) { hook_ = hook; }
+
+    // 다음 명령어 앞에서 멈춰야 하는지 (명령어 루프가 실행 직전에 호출)
+    bool debug_break() {
+        if (!hook_.callback) return false;
+        const bool at_pc = hook_.pc_mask && pc < hook_.pc_mask->size() && (*hook_.pc_mask)[pc];
+        if (!at_pc && !watch_.has_hits()) return false;
+        return hook_.callback(hook_.user, pc);
+    }
+
+    // 스냅샷: 코어 전체 복사본 (되감기/차분 테스트/세이브 스테이트용)
+    // 워치포인트와 디버거 훅은 디버거 설정이므로 restore해도 현재 값을 유지한다.
+    Derived snapshot() const { return derived(); }
+    void restore(const Derived& state) {
+        MemoryWatch<Traits::MEMORY> watch = std::move(watch_);
+        const DebugHook hook = hook_;
+        derived() = state;
+        watch_ = std::move(watch);
+        hook_ = hook;
+    }
+
+    bool needs_redraw() const { return draw_flag; }     // 화면 출력이 필요한지 여부
+    void clear_draw_flag() { draw_flag = false; }        // 화면 갱신 플래그를 false로 초기화
+    const uint8_t* get_video_buffer() const { return video.data(); }
+    uint8_t* get_keypad() { return keypad.data(); }
+    VideoBuffer& get_video() { return video; }
+
+    // 현재 해상도 크기의 화면 뷰 (플랫폼 출력용)
+    FrameView frame() const { return {video.data(), video_width_, video_height_}; }
+    unsigned int video_width() const { return video_width_; }
+    unsigned int video_height() const { return video_height_; }
+
+    // 난수 시드 (reset에도 유지되며, reset 시 난수열이 처음으로 돌아간다)
+    void set_seed(uint32_t seed) { seed_ = seed; rng_.reseed(seed); }
+    uint32_t get_seed() const { return seed_; }
+
+    // 프로그램 카운터
+    Address get_pc() const { return pc; }
+    void set_pc(Address value) { pc = value; }
+
+    // 인덱스 레지스터 I
+    Address get_I() const { return I; }
+    void set_I(Address value) { I = value; }
+
+    // 범용 레지스터 (코어별 이름 get_V / get_R은 이 함수를 감싼다)
+    Register get_register(int index) const { return registers.at(index); }
+    void set_register(int index, Register value) { registers.at(index) = value; }
+
+    // 메모리 접근 (워치포인트 페이지에 해당할 때만 느린 경로로 검사)
+    // 현재 메모리 크기를 벗어나면 std::out_of_range
+    uint8_t get_memory(int index) const {
+        uint8_t value = memory[checked_index(index)];
+        if (watch_.watches_read(index)) watch_.check_read(pc, index, value);
+        return value;
+    }
+    void set_memory(int index, uint8_t value) {
+        uint8_t& cell = memory[checked_index(index)];
+        if (watch_.watches_write(index)) watch_.check_write(pc, index, cell, value);
+        cell = value;
+    }
+
+    // 블록 메모리 연산
+    // 범위를 벗어나면 아무것도 하지 않고 false 반환, 워치포인트 페이지가 없으면 호스트 memmove/memset 한 번으로 처리
+    bool copy_memory(uint32_t dst, uint32_t src, uint32_t length) {
+        if (!range_in_memory(dst, length) || !range_in_memory(src, length)) return false;
+
+        // 감시 페이지에 걸린 경우에만 바이트 단위로 워치포인트 검사 (복사 전 원본 값 기준)
+        if (watch_.watches_read_range(src, length)) {
+            for (uint32_t i = 0; i < length; ++i) watch_.check_read(pc, src + i, memory[src + i]);
+        }
+        if (watch_.watches_write_range(dst, length)) {
+            for (uint32_t i = 0; i < length; ++i) watch_.check_write(pc, dst + i, memory[dst + i], memory[src + i]);
+        }
+
+        std::memmove(memory.data() + dst, memory.data() + src, length);
+        return true;
+    }
+    bool fill_memory(uint32_t dst, uint8_t value, uint32_t length) {
+        if (!range_in_memory(dst, length)) return false;
+
+        if (watch_.watches_write_range(dst, length)) {
+            for (uint32_t i = 0; i < length; ++i) watch_.check_write(pc, dst + i, memory[dst + i], value);
+        }
+
+        std::memset(memory.data() + dst, value, length);
+        return true;
+    }
+
+    // 워치포인트를 거치지 않는 메모리 읽기 (디버거용, 범위 밖이면 0)
+    uint8_t peek_memory(uint32_t index) const { return index < memory_size_ ? memory[index] : 0; }
+    unsigned int memory_size() const { return memory_size_; }
+
+    // 메모리 전체 읽기 전용 뷰 (상태 비교/저장용, 워치포인트를 거치지 않음, memory_size() 바이트까지 유효)
+    const uint8_t* memory_data() const { return memory.data(); }
+
+    // 메모리 워치포인트 (디버거에서 등록)
+    MemoryWatch<Traits::MEMORY>& memory_watch() { return watch_; }
+
+    // 스택
+    Address get_stack(int index) const { return stack.at(index); }
+    void set_stack(int index, Address value) { stack.at(index) = value; }
+    Address& stack_at(uint8_t index) { return stack[index]; } // 참조 리턴
+
+    // 스택 포인터
+    uint8_t get_sp() const { return sp; }
+    void set_sp(uint8_t value) { sp = value; }
+
+    // 비디오 메모리
+    uint8_t get_video(int index) const { return video.at(index); }
+    void set_video(int index, uint8_t value) { video.at(index) = value; }
+
+    // 키보드
+    uint8_t get_key(int index) const { return keypad.at(index); }
+    void set_key(int index, uint8_t value) { keypad.at(index) = value; }
+
+    // 사운드 타이머
+    uint8_t get_sound_timer() const { return sound_timer; }
+    void set_sound_timer(uint8_t value) { sound_timer = value; }
+
+    // 딜레이 타이머
+    uint8_t get_delay_timer() const { return delay_timer; }
+    void set_delay_timer(uint8_t value) { delay_timer = value; }
+
+    // 드로우 플래그
+    bool get_draw_flag() const { return draw_flag; }
+    void set_draw_flag(bool value) { draw_flag = value; }
+
+    uint32_t getCurrentOpcode() const { return static_cast<uint32_t>(opcode); }
+
+protected:
+    std::array<uint8_t, Traits::MEMORY> memory{};              // 메모리 (memory_size_까지만 사용)
+    std::array<Register, Traits::REGISTERS> registers{};        // 범용 레지스터
+    Address I = 0;                                              // 인덱스 레지스터 (메모리 주소)
+    Address pc = PROGRAM_START;                                 // 프로그램 카운터
+
+    std::array<Address, Traits::STACK> stack{};                 // 스택 (CALL/RET 용)
+    uint8_t sp = 0;                                             // 스택 포인터
+
+    Opcode opcode = 0;                                          // 현재 실행 중인 명령어
+
+    mutable MemoryWatch<Traits::MEMORY> watch_;                 // 메모리 워치포인트 (get_memory가 const라 mutable)
+    DebugHook hook_;                                            // 명령어 실행 전 디버거 검사
+    unsigned int memory_size_ = Traits::MEMORY;                 // 현재 사용 범위 (8비트 코어는 방언에 따라 줄어듦)
+    std::size_t loaded_rom_size_ = 0;
+
+    unsigned int video_width_ = VIDEO_WIDTH;
+    unsigned int video_height_ = VIDEO_HEIGHT;
+    bool halted_ = false;
+
+    uint32_t seed_ = Xorshift32::DEFAULT_SEED;
+    Xorshift32 rng_;
+
+    MachineCore() = default;
+
+    // 공통 상태 초기화 (시드, 메모리 크기, 로드한 ROM 크기는 유지)
+    // 폰트 복사 등 코어 고유 초기화는 Derived::reset에서 이어서 한다.
+    void reset_machine() {
+        pc = PROGRAM_START;
+        rng_.reseed(seed_);
+        opcode = 0;
+        I = 0;
+        sp = 0;
+        halted_ = false;
+        video_width_ = VIDEO_WIDTH;
+        video_height_ = VIDEO_HEIGHT;
+
+        memory.fill(0);
+        registers.fill(0);
+        video.fill(0);
+        stack.fill(0);
+        keypad.fill(0);
+
+        delay_timer = 0;
+        sound_timer = 0;
+        draw_flag = false;
+    }
+
+    std::size_t program_capacity() const { return memory_size_ - PROGRAM_START; }
+
+    // 현재 메모리 크기의 범위 검사 (기존 memory.at()과 같은 예외)
+    std::size_t checked_index(int index) const {
+        if (static_cast<unsigned int>(index) >= memory_size_) throw std::out_of_range("memory access");
+        return static_cast<std::size_t>(index);
+    }
+
+    // [address, address + length)가 현재 메모리 안에 있는지
+    bool range_in_memory(uint32_t address, uint32_t length) const {
+        return address <= memory_size_ && length <= memory_size_ - address;
+    }
+
+private:
+    Derived& derived() { return static_cast<Derived&>(*this); }
+    const Derived& derived() const { return static_cast<const Derived&>(*this); }
+};
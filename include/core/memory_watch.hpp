@@ -0,0 +1,169 @@
+#pragma once
+
+#include <algorithm>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+/**
+ * @brief 워치포인트 종류 (읽기 / 쓰기 / 둘 다)
+ */
+enum class WatchKind : uint8_t {
+    Read = 1,
+    Write = 2,
+    Access = Read | Write
+};
+
+/**
+ * @brief 하나의 메모리 워치포인트
+ * value가 지정되면 해당 값이 읽히거나 쓰일 때만 히트로 처리한다.
+ */
+struct Watchpoint {
+    uint32_t address;              // 감시 시작 주소
+    uint32_t length;               // 감시 범위 (바이트 수, 최소 1)
+    WatchKind kind;                // 읽기/쓰기 감시 종류
+    std::optional<uint8_t> value;  // 값 조건 (없으면 모든 접근에서 히트)
+};
+
+/**
+ * @brief 워치포인트 히트 기록
+ */
+struct WatchHit {
+    uint32_t pc;         // 메모리에 접근한 명령어의 PC
+    uint32_t address;    // 접근한 주소
+    uint8_t old_value;   // 접근 전 값
+    uint8_t new_value;   // 접근 후 값 (읽기일 경우 old_value와 같음)
+    WatchKind kind;      // Read 또는 Write
+};
+
+/**
+ * @brief 페이지 단위 비트맵을 이용한 메모리 워치포인트 관리자
+ * 감시 대상이 없는 페이지는 get_memory/set_memory마다 비트 검사 한 번으로 끝나고,
+ * 감시 중인 페이지에서만 워치포인트 목록을 확인하는 느린 경로로 들어간다.
+ * @tparam MemorySize 코어 메모리 크기 (2의 거듭제곱)
+ */
+template <std::size_t MemorySize>
+class MemoryWatch {
+public:
+    static constexpr unsigned PAGE_SHIFT = 8;                       // 256바이트 페이지
+    static constexpr std::size_t NUM_PAGES = MemorySize >> PAGE_SHIFT;
+    static constexpr std::size_t MAX_PENDING_HITS = 16;             // 한 번에 보관할 최대 히트 수
+
+    static_assert((MemorySize & (MemorySize - 1)) == 0, "MemorySize must be a power of two");
+    static_assert(NUM_PAGES > 0, "MemorySize must be at least one page");
+
+    /// @brief 해당 주소의 페이지에 읽기 워치포인트가 있는지 (빠른 경로)
+    bool watches_read(uint32_t address) const {
+        return read_pages_[(address >> PAGE_SHIFT) & (NUM_PAGES - 1)];
+    }
+
+    /// @brief 해당 주소의 페이지에 쓰기 워치포인트가 있는지 (빠른 경로)
+    bool watches_write(uint32_t address) const {
+        return write_pages_[(address >> PAGE_SHIFT) & (NUM_PAGES - 1)];
+    }
+
+    /// @brief [address, address + length) 범위 중 읽기 감시 페이지가 있는지 (블록 연산용)
+    bool watches_read_range(uint32_t address, uint32_t length) const {
+        return any_page(read_pages_, address, length);
+    }
+
+    /// @brief [address, address + length) 범위 중 쓰기 감시 페이지가 있는지 (블록 연산용)
+    bool watches_write_range(uint32_t address, uint32_t length) const {
+        return any_page(write_pages_, address, length);
+    }
+
+    void add(const Watchpoint& wp) {
+        Watchpoint entry = wp;
+        if (entry.length == 0) entry.length = 1;
+        points_.push_back(entry);
+        rebuild_pages();
+    }
+
+    /// @brief 시작 주소가 address인 워치포인트 제거
+    bool remove(uint32_t address) {
+        auto it = std::remove_if(points_.begin(), points_.end(),
+                                 [address](const Watchpoint& wp) { return wp.address == address; });
+        bool removed = it != points_.end();
+        points_.erase(it, points_.end());
+        rebuild_pages();
+        return removed;
+    }
+
+    void clear() {
+        points_.clear();
+        hits_.clear();
+        rebuild_pages();
+    }
+
+    const std::vector<Watchpoint>& points() const { return points_; }
+
+    /// @brief 읽기 접근 검사 (감시 페이지에서만 호출되는 느린 경로)
+    void check_read(uint32_t pc, uint32_t address, uint8_t value) {
+        for (const Watchpoint& wp : points_) {
+            if (matches(wp, WatchKind::Read, address, value)) {
+                record({pc, address, value, value, WatchKind::Read});
+                return;
+            }
+        }
+    }
+
+    /// @brief 쓰기 접근 검사 (감시 페이지에서만 호출되는 느린 경로)
+    void check_write(uint32_t pc, uint32_t address, uint8_t old_value, uint8_t new_value) {
+        for (const Watchpoint& wp : points_) {
+            if (matches(wp, WatchKind::Write, address, new_value)) {
+                record({pc, address, old_value, new_value, WatchKind::Write});
+                return;
+            }
+        }
+    }
+
+    bool has_hits() const { return !hits_.empty(); }
+
+    /// @brief 쌓인 히트 목록을 가져오고 비운다
+    std::vector<WatchHit> take_hits() {
+        std::vector<WatchHit> out;
+        out.swap(hits_);
+        return out;
+    }
+
+private:
+    static bool matches(const Watchpoint& wp, WatchKind access, uint32_t address, uint8_t value) {
+        if ((static_cast<uint8_t>(wp.kind) & static_cast<uint8_t>(access)) == 0) return false;
+        if (address < wp.address || address - wp.address >= wp.length) return false;
+        return !wp.value || *wp.value == value;
+    }
+
+    static bool any_page(const std::bitset<NUM_PAGES>& pages, uint32_t address, uint32_t length) {
+        if (pages.none() || length == 0) return false;
+        uint32_t first = address >> PAGE_SHIFT;
+        uint32_t last = (address + length - 1) >> PAGE_SHIFT;
+        for (uint32_t page = first; page <= last; ++page) {
+            if (pages[page & (NUM_PAGES - 1)]) return true;
+        }
+        return false;
+    }
+
+    void record(const WatchHit& hit) {
+        if (hits_.size() < MAX_PENDING_HITS) hits_.push_back(hit);
+    }
+
+    void rebuild_pages() {
+        read_pages_.reset();
+        write_pages_.reset();
+        for (const Watchpoint& wp : points_) {
+            uint32_t first = wp.address >> PAGE_SHIFT;
+            uint32_t last = (wp.address + wp.length - 1) >> PAGE_SHIFT;
+            for (uint32_t page = first; page <= last && page < NUM_PAGES; ++page) {
+                if (static_cast<uint8_t>(wp.kind) & static_cast<uint8_t>(WatchKind::Read)) read_pages_.set(page);
+                if (static_cast<uint8_t>(wp.kind) & static_cast<uint8_t>(WatchKind::Write)) write_pages_.set(page);
+            }
+        }
+    }
+
+    std::vector<Watchpoint> points_;
+    std::vector<WatchHit> hits_;
+    std::bitset<NUM_PAGES> read_pages_;
+    std::bitset<NUM_PAGES> write_pages_;
+};
@@ -1,11 +1,18 @@
 // include/core/mode_selector.hpp
 #pragma once
+#include <cstdint>
 #include <string>
 #include "common/constants.hpp"
+#include "dialect.hpp"
+#include "rom_detect.hpp"
+#include "rom_db.hpp"
+#include "common/rom_loader.hpp"
+#include "common/frame.hpp"
+#include "common/input.hpp"
 
 /**
  * @brief 모드 선택기 클래스
- * 파일 확장자를 기반으로 적절한 에뮬레이터 모드를 선택하고 실행
+ * ROM 내용(헤더, 명령어 분포)으로 적절한 에뮬레이터 모드를 선택하고 실행
  */
 class ModeSelector {
 public:
@@ -20,28 +27,108 @@ public:
      * @param enable true면 디버그 모드 활성화
      */
     static void set_debug_mode(bool enable);
+
+    /**
+     * @brief 8비트 ROM을 해석할 방언 강제 지정 (--dialect, 지정하지 않으면 ROM 내용으로 판별)
+     */
+    static void set_dialect(Dialect dialect);
+
+    /**
+     * @brief 실행할 코어 강제 지정 (--mode, 지정하지 않으면 ROM 내용으로 판별)
+     */
+    static void set_rom_kind(RomKind kind);
+
+    /**
+     * @brief 8비트 동작 차이 강제 지정 (--quirks, 지정하지 않으면 ROM 프로필)
+     */
+    static void set_quirks(const Quirks& quirks);
+
+    /**
+     * @brief ROM 프로필 데이터베이스 파일 (--romdb, 기본값: ROM과 같은 디렉토리의 romdb.txt)
+     */
+    static void set_rom_database(const std::string& path);
+
+    /**
+     * @brief 데이터베이스에 없는 ROM을 기본 설정으로 추가 기록 (--romdb-record, 나중에 조정용)
+     */
+    static void set_record_unknown_roms(bool enable);
+
+    /**
+     * @brief 오디오 출력 사용 여부 (false면 NullAudioSink, 기본값 true)
+     */
+    static void set_audio_enabled(bool enable);
+
+    /**
+     * @brief 화면 색 설정 (--fg / --bg)
+     */
+    static void set_palette(const Palette& palette);
+
+    /**
+     * @brief 프레임(1/60초)당 실행할 명령어 수 (0이면 ROM 프로필, 없으면 DEFAULT_IPF_8 / DEFAULT_IPF_32)
+     */
+    static void set_instructions_per_frame(unsigned int ipf);
+
+    /**
+     * @brief 터보(빨리 감기) 모드로 시작 (--turbo, 실행 중에는 Tab 키로 전환)
+     */
+    static void set_turbo(bool enable);
+
+    /**
+     * @brief 창/오디오 없이 실행 (--headless, SDL을 초기화하지 않으며 페이싱 없이 최대 속도)
+     */
+    static void set_headless(bool enable);
+
+    /**
+     * @brief 지정한 프레임 수만큼 실행한 뒤 종료 (--frames, 0이면 제한 없음)
+     */
+    static void set_max_frames(uint64_t frames);
+
+    /**
+     * @brief 프레임마다 화면을 기록할 파일 (--capture, .y4m이면 Y4M, 그 외 raw RGBA)
+     */
+    static void set_capture_path(const std::string& path);
+
+    /**
+     * @brief 호스트 키 → 키패드 매핑 설정 (--keymap)
+     */
+    static void set_keymap(const Keymap& keymap);
     
     static int select_and_run(const char* rom_path);
 
+    /**
+     * @brief ROM 전체를 디스어셈블하여 표준 출력으로 출력 (실행하지 않음)
+     * @param rom_path ROM 파일 경로 (실행과 같은 방식으로 8비트/32비트 판단)
+     * @return 실행 결과 (0: 성공, 1: 실패)
+     */
+    static int disassemble_rom(const char* rom_path);
+
 private:
     /**
-     * @brief 파일 확장자 추출
+     * @brief 파일 확장자 추출 (내용 판별이 애매할 때의 단서)
      * @param filename 파일명
      * @return 소문자로 변환된 확장자 (예: ".ch8", ".ch32")
      */
     static std::string get_file_extension(const std::string& filename);
     
     /**
-     * @brief 8비트 모드 실행
-     * @param rom_path ROM 파일 경로
+     * @brief 8비트 모드 실행 (코어를 준비한 뒤 공통 호스트 루프 run_machine으로 실행)
+     * @param rom_path ROM 파일 경로 (출력용)
+     * @param rom 열어 둔 ROM 이미지
+     * @param detection 판별 결과 (방언, 프로그램 시작 위치)
+     * @param profile ROM 프로필 (프레임당 명령어 수, 동작 차이)
      * @return 실행 결과
      */
-    static int run_8bit_mode(const char* rom_path);
+    static int run_8bit_mode(const char* rom_path, const RomImage& rom, const RomDetection& detection,
+                            const RomProfile& profile);
     
     /**
-     * @brief 32비트 모드 실행
-     * @param rom_path ROM 파일 경로
+     * @brief 32비트 모드 실행 (코어를 준비한 뒤 공통 호스트 루프 run_machine으로 실행)
+     * @param rom_path ROM 파일 경로 (출력용)
+     * @param rom 열어 둔 ROM 이미지
+     * @param detection 판별 결과 (방언, 프로그램 시작 위치)
+     * @param profile ROM 프로필 (프레임당 명령어 수, 동작 차이)
      * @return 실행 결과
      */
-    static int run_32bit_mode(const char* rom_path);
+    static int run_32bit_mode(const char* rom_path, const RomImage& rom, const RomDetection& detection,
+                             const RomProfile& profile);
 };
\ No newline at end of file
@@ -1,9 +1,11 @@
 #pragma once
 
+#include <array>
 #include <cstdint>
-#include <functional>
 #include <unordered_map>
-#include <iostream>
+#include <vector>
+#include "dialect.hpp"
+#include "quirks.hpp"
 
 class Chip8; // 전방 선언 (헤더에서 Chip8 전체 정의 불필요)
 
@@ -14,17 +16,52 @@ class Chip8; // 전방 선언 (헤더에서 Chip8 전체 정의 불필요)
 
 namespace OpcodeTable {
 
-    using OpcodeHandler = std::function<void(Chip8&, uint16_t)>;
+    // std::function 대신 일반 함수 포인터 (호출당 간접 분기 한 번)
+    using OpcodeHandler = void (*)(Chip8&, uint16_t);
 
-    // 명령어 0x0000 ~ 0xFFFF 중, 상위 4비트 또는 특정 패턴으로 구분하여 핸들러를 매핑합니다.
-    extern std::array<OpcodeHandler, 16> primary_table; // 예: 0x1000 => Jump
+    // 명령어 0x0000 ~ 0xFFFF 중, 상위 4비트로 구분하여 핸들러를 매핑합니다. (예: 0x1000 => Jump)
+    using DispatchTable = std::array<OpcodeHandler, 16>;
+
+    /**
+     * @brief 방언 x quirk 조합별 디스패치 테이블 (Chip8은 set_dialect / set_quirks에서 한 번 골라 포인터로 보관)
+     * 원본 CHIP-8 테이블에는 확장 명령 검사가 전혀 들어 있지 않아, 방언 지원이 기존 ROM 실행 속도에 영향을 주지 않는다.
+     * quirk도 조합마다 핸들러가 따로 인스턴스화되어 있어 명령어 실행 중에는 quirk 분기가 없다.
+     */
+    const DispatchTable& Table(Dialect dialect, const Quirks& quirks = Quirks{});
 
     /**
      * @brief 테이블을 초기화합니다. (초기 실행 시 한 번만 호출)
-     * 각 명령어 패턴에 대해 해당 핸들러 함수를 등록합니다.
+     * 모든 방언의 테이블에 각 명령어 패턴의 핸들러 함수를 등록합니다.
      */
     void Initialize();
 
     void Execute(Chip8& chip8, uint16_t opcode);
 
+    /**
+     * @brief 명령어 정의 (디스어셈블러 등 도구와 공유)
+     * (opcode & mask) == pattern 이면 해당 명령어이며, 위에서부터 먼저 일치하는 항목을 사용한다.
+     * operands 서식: %x = Vx, %y = Vy, %n = 하위 4비트, %k = 하위 8비트 상수, %a = 12비트 주소,
+     *               %p = X 자리 4비트 숫자 (XO-CHIP 평면 번호), %l = 다음 2바이트 16비트 주소 (XO-CHIP F000 NNNN)
+     * dialect는 명령어가 처음 등장한 방언으로, 그보다 낮은 방언의 핸들러는 이 opcode를 OP_UNKNOWN으로 처리한다.
+     */
+    struct OpcodeInfo {
+        uint16_t mask;
+        uint16_t pattern;
+        const char* mnemonic;
+        const char* operands;
+        Dialect dialect = Dialect::Chip8;
+    };
+
+    /// @brief 모든 명령어 정의 목록
+    const std::vector<OpcodeInfo>& Definitions();
+
+    /**
+     * @brief dialect에서 opcode에 해당하는 명령어 정의 (없으면 nullptr)
+     * 상위 4비트별로 나눈 정의 목록만 훑는다. 기본값 XoChip은 모든 방언의 명령어를 포함한다.
+     */
+    const OpcodeInfo* Lookup(uint16_t opcode, Dialect dialect = Dialect::XoChip);
+
+    /// @brief 정의되지 않은 opcode (경고 후 다음 명령어로 진행, 모든 핸들러의 미정의 경로가 이 함수를 거침)
+    void OP_UNKNOWN(Chip8& chip8, uint16_t opcode);
+
 } // namespace OpcodeTable
\ No newline at end of file
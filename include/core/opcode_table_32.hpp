@@ -1,12 +1,12 @@
 #pragma once
 
 #include <cstdint>
-#include <functional>
+#include <array>
 #include <unordered_map>
-#include <iostream>
+#include <vector>
 
-constexpr uint8_t IMPLEMENTED_OPCODES = 16;  // 현재 구현된 opcode 수
-constexpr uint8_t MAX_OPCODES = 20;          // 최대 확장 가능한 opcode 수
+constexpr uint16_t OPCODE_TABLE_SIZE_32 = 256;  // 상위 8비트 전체 (미구현 slot은 기본 핸들러)
+constexpr uint16_t PACKED_TABLE_SIZE_32 = 256;  // 패킷 연산 그룹(0x14)의 하위 연산 ZZ 전체
 
 class Chip8_32; // 전방 선언 
 
@@ -17,10 +17,14 @@ class Chip8_32; // 전방 선언
 
 namespace OpcodeTable_32 {
 
-    using OpcodeHandler32 = std::function<void(Chip8_32&, uint32_t)>;
+    // std::function 대신 일반 함수 포인터 (호출당 간접 분기 한 번)
+    using OpcodeHandler32 = void (*)(Chip8_32&, uint32_t);
 
-    // 명령어 0x00000000 ~ 0xFFFFFFFF 중, 상위 4비트 또는 특정 패턴으로 구분하여 핸들러를 매핑합니다.
-    extern std::array<OpcodeHandler32, 20> primary_table_32; 
+    // opcode 상위 8비트로 바로 인덱싱하는 256칸 테이블 (범위 검사 없음)
+    extern std::array<OpcodeHandler32, OPCODE_TABLE_SIZE_32> primary_table_32;
+
+    // 패킷(SWAR) 연산 그룹 14XXYYZZ 전용 테이블 (ZZ로 인덱싱, 기존 08XXYYZZ switch와 분리)
+    extern std::array<OpcodeHandler32, PACKED_TABLE_SIZE_32> packed_table_32;
 
     /**
      * @brief 테이블을 초기화합니다. (초기 실행 시 한 번만 호출)
@@ -30,4 +34,27 @@ namespace OpcodeTable_32 {
 
     void Execute(Chip8_32& chip8_32, uint32_t opcode);
 
+    /**
+     * @brief 명령어 정의 (디스어셈블러 등 도구와 공유)
+     * (opcode & mask) == pattern 이면 해당 명령어이며, 위에서부터 먼저 일치하는 항목을 사용한다.
+     * operands 서식: %x = Rxx, %y = Ryy, %n = 하위 8비트(10진수), %b = 하위 8비트(16진수),
+     *               %k = 16비트 상수, %a = 24비트 주소
+     */
+    struct OpcodeInfo32 {
+        uint32_t mask;
+        uint32_t pattern;
+        const char* mnemonic;
+        const char* operands;
+    };
+
+    /// @brief 모든 명령어 정의 목록
+    const std::vector<OpcodeInfo32>& Definitions();
+
+    /// @brief opcode에 해당하는 명령어 정의 (없으면 nullptr, 상위 8비트별로 나눈 정의 목록만 훑음)
+    const OpcodeInfo32* Lookup(uint32_t opcode);
+
+    /// @brief 정의되지 않은 opcode (경고 후 다음 명령어로 진행)
+    /// 빈 primary/packed slot과 그룹 핸들러의 미정의 세부 코드가 모두 이 함수를 거친다.
+    void OP_UNIMPLEMENTED(Chip8_32& chip8_32, uint32_t opcode);
+
 } // namespace OpcodeTable_32
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief 8비트 CHIP-8 동작 차이 (같은 방언 안에서도 ROM마다 기대하는 동작이 다름)
+ * 기본값(모두 false)은 지금까지의 동작이다: 시프트는 Vx, FX55/FX65는 I 유지,
+ * 논리 연산은 VF 유지, 스프라이트는 화면 끝에서 반대편으로 wrap, BNNN은 V0 사용.
+ */
+struct Quirks {
+    bool shift_vy = false;   // shift  : 8XY6 / 8XYE가 Vy를 시프트해 Vx에 저장 (COSMAC VIP)
+    bool memory_i = false;   // memory : FX55 / FX65 후 I += X + 1
+    bool vf_reset = false;   // vfreset: 8XY1 / 8XY2 / 8XY3 후 VF = 0
+    bool clip = false;       // clip   : 시작 좌표만 wrap하고 화면 밖으로 나간 부분은 잘라냄
+    bool jump_vx = false;    // jump   : BXNN = XNN + Vx (SUPER-CHIP)
+
+    /// @brief QUIRK_* 비트 조합 (디스패치 테이블 인덱스)
+    uint8_t mask() const;
+
+    bool operator==(const Quirks& other) const {
+        return shift_vy == other.shift_vy && memory_i == other.memory_i && vf_reset == other.vf_reset &&
+               clip == other.clip && jump_vx == other.jump_vx;
+    }
+    bool operator!=(const Quirks& other) const { return !(*this == other); }
+};
+
+// Quirks::mask() 비트 (조합마다 8비트 코어의 핸들러가 따로 인스턴스화됨)
+constexpr uint8_t QUIRK_SHIFT = 1 << 0;
+constexpr uint8_t QUIRK_MEMORY = 1 << 1;
+constexpr uint8_t QUIRK_VF_RESET = 1 << 2;
+constexpr uint8_t QUIRK_CLIP = 1 << 3;
+constexpr uint8_t QUIRK_JUMP = 1 << 4;
+constexpr unsigned int NUM_QUIRK_SETS = 1 << 5;
+
+inline uint8_t Quirks::mask() const {
+    return static_cast<uint8_t>((shift_vy ? QUIRK_SHIFT : 0) | (memory_i ? QUIRK_MEMORY : 0) |
+                                (vf_reset ? QUIRK_VF_RESET : 0) | (clip ? QUIRK_CLIP : 0) | (jump_vx ? QUIRK_JUMP : 0));
+}
+
+/**
+ * @brief 컴파일 타임 동작 차이 (핸들러 템플릿 인자)
+ * 핸들러는 if constexpr로 분기하므로 선택된 인터프리터의 실행 경로에는 quirk 검사가 남지 않는다.
+ */
+template <uint8_t Mask>
+struct QuirkTraits {
+    static constexpr bool shift_vy = (Mask & QUIRK_SHIFT) != 0;
+    static constexpr bool memory_i = (Mask & QUIRK_MEMORY) != 0;
+    static constexpr bool vf_reset = (Mask & QUIRK_VF_RESET) != 0;
+    static constexpr bool clip = (Mask & QUIRK_CLIP) != 0;
+    static constexpr bool jump_vx = (Mask & QUIRK_JUMP) != 0;
+};
+
+/// @brief "none" 또는 쉼표로 구분한 이름 목록 (shift,memory,vfreset,clip,jump) 파싱
+inline bool parse_quirks(const std::string& text, Quirks& quirks) {
+    Quirks result;
+    if (text != "none") {
+        std::size_t start = 0;
+        while (start <= text.size()) {
+            std::size_t end = text.find(',', start);
+            if (end == std::string::npos) end = text.size();
+            const std::string name = text.substr(start, end - start);
+            if (name == "shift") result.shift_vy = true;
+            else if (name == "memory") result.memory_i = true;
+            else if (name == "vfreset") result.vf_reset = true;
+            else if (name == "clip") result.clip = true;
+            else if (name == "jump") result.jump_vx = true;
+            else return false;
+            start = end + 1;
+        }
+    }
+    quirks = result;
+    return true;
+}
+
+/// @brief parse_quirks와 같은 형식의 문자열
+inline std::string quirks_name(const Quirks& quirks) {
+    std::string text;
+    auto add = [&text](bool enabled, const char* name) {
+        if (!enabled) return;
+        if (!text.empty()) text += ',';
+        text += name;
+    };
+    add(quirks.shift_vy, "shift");
+    add(quirks.memory_i, "memory");
+    add(quirks.vf_reset, "vfreset");
+    add(quirks.clip, "clip");
+    add(quirks.jump_vx, "jump");
+    return text.empty() ? "none" : text;
+}
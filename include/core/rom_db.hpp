@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include "dialect.hpp"
+#include "quirks.hpp"
+
+/// @brief ROM 하나의 실행 설정 (지정하지 않은 항목은 코어/판별 기본값)
+struct RomProfile {
+    std::string name;
+    unsigned int ipf = 0;            // 프레임당 명령어 수 (0 = 코어 기본값)
+    bool has_dialect = false;
+    Dialect dialect = Dialect::Chip8;
+    bool has_quirks = false;
+    Quirks quirks;
+};
+
+/**
+ * @brief ROM 내용 해시(XXH64)로 찾는 프로필 데이터베이스
+ *
+ * 텍스트 파일 한 줄이 ROM 하나이며, 프로그램 시작 시 한 번 읽기 전용으로 매핑해 파싱한 뒤
+ * 해시 테이블로 O(1) 조회한다. 파일 이름이 바뀌어도 같은 ROM이면 같은 설정을 쓴다.
+ *
+ *   # 주석
+ *   <xxh64 16진수> [name=<이름>] [ipf=<n>] [dialect=chip8|schip|xochip] [quirks=none|shift,memory,vfreset,clip,jump]
+ *
+ * 해시는 헤더를 뺀 프로그램 바이트(0x200에 로드되는 내용) 기준이다.
+ */
+class RomDatabase {
+public:
+    static constexpr const char* DEFAULT_FILE = "romdb.txt";
+
+    /// @brief 프로그램 바이트의 해시 (데이터베이스 키)
+    static uint64_t hash(const uint8_t* data, std::size_t size);
+
+    /// @brief 파일을 읽어 항목 추가 (파일이 없으면 false, 잘못된 줄은 경고 후 건너뜀)
+    bool load(const std::string& path);
+
+    /// @brief 텍스트에서 항목 추가 (잘못된 줄 수를 돌려줌)
+    std::size_t parse(const char* text, std::size_t size, const std::string& source = "romdb");
+
+    /// @brief 해시로 프로필 조회 (없으면 nullptr)
+    const RomProfile* find(uint64_t hash) const;
+
+    std::size_t size() const { return entries_.size(); }
+
+    /// @brief parse가 읽는 형식의 한 줄 (줄바꿈 제외)
+    static std::string format_line(uint64_t hash, const RomProfile& profile);
+
+    /// @brief 파일 끝에 항목 한 줄 추가 (모르는 ROM을 나중에 조정하려고 기록할 때)
+    static bool append(const std::string& path, uint64_t hash, const RomProfile& profile);
+
+private:
+    std::unordered_map<uint64_t, RomProfile> entries_;
+};
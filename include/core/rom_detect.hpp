@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "dialect.hpp"
+
+/// @brief ROM을 실행할 코어
+enum class RomKind : uint8_t {
+    Chip8,     // 8비트 코어 (2바이트 명령어, 방언은 Dialect로 구분)
+    Chip8_32   // 32비트 확장 코어 (4바이트 명령어)
+};
+
+/// @brief "8", "32" (또는 "chip8", "chip8_32") 파싱
+inline bool parse_rom_kind(const std::string& text, RomKind& kind) {
+    if (text == "8" || text == "chip8") kind = RomKind::Chip8;
+    else if (text == "32" || text == "chip8_32") kind = RomKind::Chip8_32;
+    else return false;
+    return true;
+}
+
+inline const char* rom_kind_name(RomKind kind) {
+    return kind == RomKind::Chip8 ? "8-bit CHIP-8" : "32-bit CHIP-8";
+}
+
+/**
+ * @brief 선택적 ROM 헤더 (8바이트, 있으면 검사 없이 그대로 따름)
+ *   "C8RM" | 코어 (0 = 8비트, 1 = 32비트) | 방언 (Dialect 값) | 예약 2바이트
+ * 프로그램은 헤더 바로 뒤부터이며 0x200에 로드된다.
+ */
+constexpr char ROM_HEADER_MAGIC[4] = {'C', '8', 'R', 'M'};
+constexpr std::size_t ROM_HEADER_SIZE = 8;
+
+// 판별에 쓰는 앞부분 길이 (코드는 보통 0x200 근처에 모여 있음)
+constexpr std::size_t DETECT_SCAN_BYTES = 4096;
+
+/// @brief 판별 결과
+struct RomDetection {
+    RomKind kind = RomKind::Chip8;
+    Dialect dialect = Dialect::Chip8;
+    std::size_t offset = 0;      // 프로그램 시작 위치 (헤더가 있으면 ROM_HEADER_SIZE)
+    bool from_header = false;
+    bool confident = false;      // 두 ISA 점수 차이가 충분히 큼 (아니면 확장자 등 다른 단서를 우선)
+    float score_8 = 0.0f;        // 8비트로 해석했을 때 유효 명령어 비율 (0 ~ 1)
+    float score_32 = 0.0f;       // 32비트로 해석했을 때 유효 명령어 비율 (0 ~ 1)
+};
+
+/**
+ * @brief ROM 내용으로 코어와 방언을 추정
+ *
+ * 앞쪽 DETECT_SCAN_BYTES만 명령어 단위로 훑어, 각 ISA의 명령어 정의(OpcodeTable::Lookup)에
+ * 맞는 워드의 비율을 점수로 쓴다. 0으로 채운 워드는 양쪽 모두 세지 않는다.
+ *   - 8비트: 0NNN(SYS)는 실제 프로그램에서 쓰이지 않으므로 무효로 센다 (32비트 ROM의 상위 바이트가 대개 0x0X).
+ *   - 32비트: 4바이트 정렬 워드만 보며, 크기가 4의 배수가 아니면 점수를 조금 깎는다.
+ * 8비트로 판정되면 확장 명령(SUPER-CHIP / XO-CHIP 전용)이 두 번 이상 나오거나
+ * CHIP-8 메모리에 들어가지 않는 크기일 때 해당 방언을 고른다.
+ */
+RomDetection detect_rom(const uint8_t* data, std::size_t size);
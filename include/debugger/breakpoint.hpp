@@ -0,0 +1,66 @@
+#pragma once
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+#include "debugger/expression.hpp"
+
+namespace chip8emu {
+
+/**
+ * @brief 브레이크포인트 / 트레이스포인트 하나
+ * condition이 있으면 PC가 일치하고 조건이 참일 때만 동작한다.
+ * trace가 true이면 멈추지 않고 trace_exprs 값들을 한 줄로 출력한 뒤 계속 실행한다.
+ */
+struct Breakpoint {
+    std::optional<Expression> condition;   // 조건식 (없으면 무조건)
+    bool trace = false;                    // 트레이스포인트 여부
+    std::vector<Expression> trace_exprs;   // 트레이스 시 출력할 식들
+    uint64_t hit_count = 0;                // 조건을 만족한 횟수
+};
+
+/**
+ * @brief 주소별 브레이크포인트 테이블
+ * 주소 공간 크기의 비트맵으로 먼저 거르므로, 브레이크포인트가 없는 PC에서는
+ * 비트 검사 한 번만 수행된다. 코어의 명령어 루프도 이 비트맵을 직접 검사한다 (DebugHook).
+ */
+class BreakpointTable {
+public:
+    explicit BreakpointTable(uint32_t address_space) : mask_(address_space, false) {}
+
+    void add(uint32_t address, Breakpoint bp) {
+        entries_[address] = std::move(bp);
+        if (address < mask_.size()) mask_[address] = true;
+    }
+
+    bool remove(uint32_t address) {
+        if (address < mask_.size()) mask_[address] = false;
+        return entries_.erase(address) > 0;
+    }
+
+    void clear() {
+        entries_.clear();
+        mask_.assign(mask_.size(), false);
+    }
+
+    bool contains(uint32_t address) const { return entries_.count(address) > 0; }
+
+    /// @brief 해당 주소의 브레이크포인트 (없으면 nullptr, 빠른 경로는 비트맵 검사)
+    Breakpoint* find(uint32_t address) {
+        if (address >= mask_.size() || !mask_[address]) return nullptr;
+        auto it = entries_.find(address);
+        return it != entries_.end() ? &it->second : nullptr;
+    }
+
+    const std::map<uint32_t, Breakpoint>& entries() const { return entries_; }
+
+    /// @brief 브레이크포인트가 있는 주소의 비트맵 (주소 공간 크기, 테이블과 수명이 같음)
+    const std::vector<bool>& mask() const { return mask_; }
+
+private:
+    std::vector<bool> mask_;
+    std::map<uint32_t, Breakpoint> entries_;
+};
+
+} // namespace chip8emu
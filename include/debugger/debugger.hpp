@@ -1,7 +1,9 @@
 #pragma once
 #include <cstdint>
 #include <string>
-#include <set>
+#include "core/memory_watch.hpp"
+#include "debugger/breakpoint.hpp"
+#include "debugger/disassembler.hpp"
 
 // 전방 선언 (네임스페이스 없이)
 class Chip8;
@@ -12,19 +14,25 @@ namespace chip8emu {
 // 8비트용 디버거
 class Debugger8 {
 public:
-    explicit Debugger8(Chip8& chip8)
-        : chip8_(chip8), enabled_(false), step_mode_(false) {}
+    explicit Debugger8(Chip8& chip8);
+    ~Debugger8();
 
-    void enable(bool on = true) { enabled_ = on; }
+    /// @brief 켜면 코어의 명령어 루프에 검사 지점(DebugHook)을 연결, 끄면 해제
+    void enable(bool on = true);
     bool isEnabled() const { return enabled_; }
     void setStepMode(bool on = true) { step_mode_ = on; }
     bool isStepMode() const { return step_mode_; }
 
-    void addBreakpoint(uint16_t address) { breakpoints_.insert(address); }
-    void removeBreakpoint(uint16_t address) { breakpoints_.erase(address); }
-    bool hasBreakpoint(uint16_t address) const { return breakpoints_.count(address) > 0; }
+    void addBreakpoint(uint16_t address) { breakpoints_.add(address, Breakpoint{}); }
+    void addBreakpoint(uint16_t address, Breakpoint bp) { breakpoints_.add(address, std::move(bp)); }
+    void removeBreakpoint(uint16_t address) { breakpoints_.remove(address); }
+    bool hasBreakpoint(uint16_t address) const { return breakpoints_.contains(address); }
     void clearBreakpoints() { breakpoints_.clear(); }
 
+    void addWatchpoint(const Watchpoint& wp);
+    bool removeWatchpoint(uint32_t address);
+    void clearWatchpoints();
+
     void printState(uint32_t opcode);
     std::string disassemble(uint32_t opcode);
     void handleDebugInput();
@@ -33,7 +41,14 @@ private:
     Chip8& chip8_;
     bool enabled_;
     bool step_mode_;
-    std::set<uint16_t> breakpoints_;
+    bool break_checked_ = false;    // 현재 PC의 브레이크포인트를 훅에서 이미 평가함
+    bool resuming_ = false;         // continue 직후 (resume_pc_의 브레이크포인트를 한 번 건너뜀)
+    uint32_t resume_pc_ = 0;
+    BreakpointTable breakpoints_;
+    Disassembler disasm_;
+
+    static bool breakHook(void* self, uint32_t pc);
+    bool checkBreak(uint32_t pc);
 
     std::string toHex8(uint8_t value) const;
     std::string toHex16(uint16_t value) const;
@@ -43,19 +58,25 @@ private:
 // 32비트용 디버거
 class Debugger32 {
 public:
-    explicit Debugger32(Chip8_32& chip8)
-        : chip8_(chip8), enabled_(false), step_mode_(false) {}
+    explicit Debugger32(Chip8_32& chip8);
+    ~Debugger32();
 
-    void enable(bool on = true) { enabled_ = on; }
+    /// @brief 켜면 코어의 명령어 루프에 검사 지점(DebugHook)을 연결, 끄면 해제
+    void enable(bool on = true);
     bool isEnabled() const { return enabled_; }
     void setStepMode(bool on = true) { step_mode_ = on; }
     bool isStepMode() const { return step_mode_; }
 
-    void addBreakpoint(uint16_t address) { breakpoints_.insert(address); }
-    void removeBreakpoint(uint16_t address) { breakpoints_.erase(address); }
-    bool hasBreakpoint(uint16_t address) const { return breakpoints_.count(address) > 0; }
+    void addBreakpoint(uint32_t address) { breakpoints_.add(address, Breakpoint{}); }
+    void addBreakpoint(uint32_t address, Breakpoint bp) { breakpoints_.add(address, std::move(bp)); }
+    void removeBreakpoint(uint32_t address) { breakpoints_.remove(address); }
+    bool hasBreakpoint(uint32_t address) const { return breakpoints_.contains(address); }
     void clearBreakpoints() { breakpoints_.clear(); }
 
+    void addWatchpoint(const Watchpoint& wp);
+    bool removeWatchpoint(uint32_t address);
+    void clearWatchpoints();
+
     void printState(uint32_t opcode);
     std::string disassemble(uint32_t opcode);
     void handleDebugInput();
@@ -64,7 +85,14 @@ private:
     Chip8_32& chip8_;
     bool enabled_;
     bool step_mode_;
-    std::set<uint16_t> breakpoints_;
+    bool break_checked_ = false;    // 현재 PC의 브레이크포인트를 훅에서 이미 평가함
+    bool resuming_ = false;         // continue 직후 (resume_pc_의 브레이크포인트를 한 번 건너뜀)
+    uint32_t resume_pc_ = 0;
+    BreakpointTable breakpoints_;
+    Disassembler disasm_;
+
+    static bool breakHook(void* self, uint32_t pc);
+    bool checkBreak(uint32_t pc);
 
     std::string toHex8(uint8_t value) const;
     std::string toHex16(uint16_t value) const;
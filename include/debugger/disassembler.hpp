@@ -0,0 +1,64 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "core/dialect.hpp"
+#include "debugger/isa.hpp"
+
+namespace chip8emu {
+
+/**
+ * @brief 테이블 기반 디스어셈블러 (피연산자 포함, 예: "LD V3, 0x1F", "DRW R2, R4, 8")
+ * 명령어 정의는 인터프리터와 같은 OpcodeTable::Definitions() / OpcodeTable_32::Definitions()를 사용한다.
+ * 주소별 캐시를 두어, 같은 주소에 같은 opcode가 있으면 다시 해석하지 않고 저장된 문자열을 돌려준다.
+ * 8비트는 코어가 실행하는 방언의 정의만 사용한다 (예: CHIP-8에서 00FF는 HIGH가 아니라 SYS).
+ */
+class Disassembler {
+public:
+    Disassembler(Isa isa, uint32_t address_space, Dialect dialect = Dialect::XoChip);
+
+    /// @brief 8비트 방언 변경 (바뀌면 캐시를 비움)
+    void set_dialect(Dialect dialect);
+    Dialect dialect() const { return dialect_; }
+
+    /**
+     * @brief 캐시를 거친 디스어셈블 (트레이스/디버거용)
+     * @param address 명령어 주소 (캐시 키)
+     * @param opcode 해당 주소의 opcode (캐시된 값과 다르면 다시 해석 - 자기 수정 코드 대응)
+     * @param next 다음 2바이트 (XO-CHIP F000 NNNN의 주소, 그 외에는 무시)
+     */
+    const std::string& at(uint32_t address, uint32_t opcode, uint16_t next = 0);
+
+    /// @brief 캐시 없이 opcode 하나를 해석 (dialect와 next는 8비트에만 적용)
+    static std::string format(Isa isa, uint32_t opcode, Dialect dialect = Dialect::XoChip, uint16_t next = 0);
+
+    /**
+     * @brief ROM 이미지 전체를 "주소: opcode  명령어" 형식으로 출력
+     * @param base ROM이 적재되는 주소 (보통 0x200)
+     */
+    static void dump(Isa isa, Dialect dialect, const uint8_t* data, std::size_t size, uint32_t base, std::ostream& out);
+
+    /// @brief 명령어 크기 (바이트, XO-CHIP의 F000 NNNN은 코어와 같이 4바이트 명령어 하나)
+    static constexpr uint32_t instructionSize(Isa isa, Dialect dialect, uint32_t opcode) {
+        if (isa == Isa::Chip8_32) return 4;
+        return dialect == Dialect::XoChip && opcode == 0xF000 ? 4 : 2;
+    }
+
+private:
+    struct Entry {
+        uint32_t opcode = 0;
+        uint16_t next = 0;
+        bool valid = false;
+        std::string text;
+    };
+
+    Isa isa_;
+    uint32_t address_space_;
+    Dialect dialect_;
+    std::vector<Entry> cache_;   // 첫 사용 시 할당
+    std::string out_of_range_;   // 캐시 범위 밖 주소용 임시 버퍼
+};
+
+} // namespace chip8emu
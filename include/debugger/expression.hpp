@@ -0,0 +1,71 @@
+#pragma once
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+#include "debugger/isa.hpp"
+
+// 전방 선언 (네임스페이스 없이)
+class Chip8;
+class Chip8_32;
+
+namespace chip8emu {
+
+/**
+ * @brief 디버거 조건식 (예: "V3 == 0x10 && I > 0x300", "R15 != 0")
+ * 문자열은 등록 시 한 번만 파싱되어 작은 스택 기반 바이트코드로 컴파일되고,
+ * 매 명령어마다는 바이트코드만 실행된다.
+ *
+ * 지원 항목:
+ *  - 피연산자: V0~VF (8비트) / R0~R31 (32비트), I, PC, SP, DT, ST, 숫자(10진수, 0x16진수)
+ *  - 메모리 읽기: [expr] (워치포인트를 건드리지 않는 1바이트 읽기)
+ *  - 연산자: ! ~ -(단항), + -, < <= > >=, == !=, &, ^, |, &&, ||, 괄호
+ */
+class Expression {
+public:
+    using Isa = chip8emu::Isa;
+
+    /**
+     * @brief 조건식 컴파일
+     * @param source 조건식 문자열
+     * @param isa 레지스터 이름(V/R) 해석 기준
+     * @param error 실패 시 오류 메시지 (nullptr 가능)
+     * @return 컴파일된 식, 문법 오류면 std::nullopt
+     */
+    static std::optional<Expression> compile(const std::string& source, Isa isa,
+                                             std::string* error = nullptr);
+
+    uint32_t evaluate(const Chip8& chip8) const;
+    uint32_t evaluate(const Chip8_32& chip8_32) const;
+
+    /// @brief 조건 판정 (결과가 0이 아니면 참)
+    template <class Core>
+    bool test(const Core& core) const { return evaluate(core) != 0; }
+
+    const std::string& source() const { return source_; }
+
+    // 바이트코드 명령 (후위 표기 순서)
+    enum class Op : uint8_t {
+        PushConst, PushReg, PushI, PushPC, PushSP, PushDT, PushST, LoadMem,
+        Not, BitNot, Neg,
+        Add, Sub, And, Or, Xor,
+        Eq, Ne, Lt, Le, Gt, Ge,
+        LogicalAnd, LogicalOr
+    };
+
+    struct Instr {
+        Op op;
+        uint32_t arg;
+    };
+
+    static constexpr std::size_t MAX_STACK = 32;  // 평가 스택 최대 깊이
+
+private:
+    template <class Core>
+    uint32_t run(const Core& core) const;
+
+    std::vector<Instr> code_;
+    std::string source_;
+};
+
+} // namespace chip8emu
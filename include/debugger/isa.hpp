@@ -0,0 +1,11 @@
+#pragma once
+
+namespace chip8emu {
+
+// 디버거 도구(조건식, 디스어셈블러)가 해석할 명령어 집합
+enum class Isa {
+    Chip8,     // 8비트 CHIP-8 (2바이트 명령어, V0~VF)
+    Chip8_32   // 32비트 확장 (4바이트 명령어, R0~R31)
+};
+
+} // namespace chip8emu
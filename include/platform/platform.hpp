@@ -4,6 +4,8 @@
 #include <cstdint>
 #include <SDL2/SDL.h>
 #include "common/constants.hpp"
+#include "common/frame.hpp"
+#include "common/input.hpp"
 
 /**
  * @brief WSL2/X11 대응 Platform 클래스 (SDL2 기반)
@@ -11,9 +13,22 @@
 class Platform {
 public:
     Platform(const char* title, int window_width, int window_height, int texture_width, int texture_height);
+    // SDL, 창, 렌더러, 텍스처 생성 (실패하면 오류를 출력하고 false, 만든 자원은 소멸자가 정리)
     bool Initialize();
-    bool ProcessInput(std::array<uint8_t, 16>& keypad);
-    void Update(const std::array<uint8_t, VIDEO_WIDTH * VIDEO_HEIGHT>& video, int pitch);
+    // SDL 이벤트를 처리해 키 변화를 큐에 넣음 (창 닫기 요청이면 true)
+    // 터보 단축키(Tab)가 눌렸으면 toggle_turbo를 true로 설정
+    // SDL 이벤트 처리는 Initialize를 호출한 스레드에서 해야 한다
+    bool ProcessInput(KeyEventQueue& events, bool& toggle_turbo);
+    // 화면 크기가 텍스처와 다르면 (해상도 모드 전환) 텍스처를 다시 만든 뒤 출력
+    void Update(const FrameView& frame);
+
+    // 픽셀 값 → 색 LUT 갱신 (Update 전에 언제든 호출 가능)
+    void SetPalette(const Palette& palette);
+    // 호스트 키 → 키패드 매핑 교체
+    void SetKeymap(const Keymap& keymap) { keymap_ = keymap; }
+    void SetTitle(const char* title);
+    // 창이 있는 디스플레이의 주사율 (알 수 없으면 60)
+    int RefreshRate() const;
     ~Platform();
 
 private:
@@ -25,4 +40,9 @@ private:
     int window_height_;
     int texture_width_;
     int texture_height_;
+
+    Keymap keymap_;
+    std::array<uint32_t, 256> lut_;  // 픽셀 바이트 값 → RGBA8888 (분기 없이 한 번 읽기로 변환)
+
+    bool CreateTexture(int width, int height);
 };
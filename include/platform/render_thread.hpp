@@ -0,0 +1,89 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include "common/frame.hpp"
+#include "common/input.hpp"
+#include "common/triple_buffer.hpp"
+
+class Platform;
+
+/**
+ * @brief Platform(SDL 창/렌더러/이벤트)을 전용 스레드에서 돌리는 표시 담당
+ *
+ * - 에뮬레이션 스레드는 submit()으로 완성된 프레임을 삼중 버퍼에 복사해 두고 바로 돌아간다.
+ *   SDL_RenderClear/RenderCopy/RenderPresent(및 vsync 대기)는 렌더 스레드에서만 일어난다.
+ * - 렌더 스레드가 처리한 키 입력은 SPSC 큐로 돌아오며, poll_input()에서 키패드에 반영한다.
+ * SDL 창 생성과 이벤트 처리는 같은 스레드에서 해야 하므로 Platform 전체를 렌더 스레드가 소유한다.
+ * - 표시는 디스플레이 주사율당 최대 한 번이며, 터보 모드(Tab)에서는 창 제목에 실제 에뮬레이션 배속을 표시한다.
+ */
+class RenderThread {
+public:
+    RenderThread(const char* title, int window_width, int window_height, int texture_width, int texture_height,
+                 const Palette& palette = Palette{}, const Keymap& keymap = Keymap{});
+    ~RenderThread();
+
+    RenderThread(const RenderThread&) = delete;
+    RenderThread& operator=(const RenderThread&) = delete;
+
+    /// @brief 렌더 스레드 시작 (Platform 초기화가 끝날 때까지 대기, 실패하면 false)
+    bool start();
+
+    /// @brief 렌더 스레드 종료 및 합류 (소멸자에서도 호출)
+    void stop();
+
+    /// @brief 완성된 프레임을 공개 (대기 없음, 표시가 밀리면 이전 미표시 프레임은 덮어씀)
+    void submit(const FrameView& frame);
+
+    /**
+     * @brief 프레임 시작 시 한 번: 쌓인 키 이벤트를 이번 프레임의 명령어 위치로 배치
+     * 실제 키패드 반영은 실행 루프가 명령어마다 input.apply()로 한다.
+     * @return 창 닫기 요청이 있었으면 true
+     */
+    bool poll_input(InputScheduler& input, uint32_t instructions_per_frame);
+
+    /// @brief 이전에 submit한 프레임이 아직 표시되지 않았는지 (터보 모드에서 변환/복사를 건너뛸지 판단)
+    bool presenter_behind() const { return frames_.pending(); }
+
+    /// @brief 에뮬레이션 프레임 하나를 마쳤음을 알림 (배속 계산용, 에뮬레이션 스레드 전용)
+    void count_emulated_frame() { emulated_.store(++emulated_local_, std::memory_order_relaxed); }
+
+    /// @brief 터보(빨리 감기) 모드: 페이싱 없이 최대 속도로 실행 (Tab 키로 전환)
+    bool turbo() const { return turbo_.load(std::memory_order_relaxed); }
+    void set_turbo(bool enable) { turbo_.store(enable, std::memory_order_relaxed); }
+
+    /// @brief 렌더 스레드가 실제로 화면에 표시한 프레임 수
+    uint64_t presented_frames() const { return presented_.load(std::memory_order_relaxed); }
+
+private:
+    void run();
+    void update_title(Platform& platform, uint64_t now_ns);
+
+    std::string title_;
+    int window_width_;
+    int window_height_;
+    int texture_width_;
+    int texture_height_;
+    Palette palette_;
+    Keymap keymap_;
+
+    TripleBuffer<FrameBuffer> frames_;
+    KeyEventQueue key_events_;
+
+    std::thread thread_;
+    std::atomic<bool> running_{false};
+    std::atomic<int> init_state_{0};          // 0 = 초기화 중, 1 = 성공, -1 = 실패
+    std::atomic<bool> quit_requested_{false};
+    std::atomic<uint64_t> presented_{0};
+    std::atomic<bool> turbo_{false};
+
+    // 배속 표시 (emulated_는 에뮬레이션 스레드가 쓰고 렌더 스레드가 읽음)
+    std::atomic<uint64_t> emulated_{0};
+    uint64_t emulated_local_ = 0;             // 에뮬레이션 스레드 전용
+    uint64_t speed_window_start_ns_ = 0;      // 이하 렌더 스레드 전용
+    uint64_t speed_window_frames_ = 0;
+    bool title_shows_speed_ = false;
+};
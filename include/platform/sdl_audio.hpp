@@ -0,0 +1,38 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <SDL2/SDL.h>
+#include "common/audio.hpp"
+#include "common/spsc_ring.hpp"
+
+/**
+ * @brief SDL 오디오 콜백으로 재생하는 AudioSink
+ * 에뮬레이션 스레드가 submit으로 SPSC 링에 넣고, SDL 오디오 스레드의 콜백이 꺼내 간다.
+ * 콜백에서 데이터가 모자라면 (언더런) 나머지를 무음으로 채우고 횟수만 센다.
+ */
+class SdlAudioSink : public AudioSink {
+public:
+    SdlAudioSink() = default;
+    ~SdlAudioSink() override;
+
+    SdlAudioSink(const SdlAudioSink&) = delete;
+    SdlAudioSink& operator=(const SdlAudioSink&) = delete;
+
+    /// @brief 오디오 장치 열기 (실패하면 false, 이 경우 NullAudioSink를 대신 사용)
+    bool open(unsigned int sample_rate = 44100);
+
+    unsigned int sample_rate() const override { return sample_rate_; }
+    std::size_t queued() const override { return ring_.size(); }
+    std::size_t submit(const int16_t* samples, std::size_t count) override { return ring_.push(samples, count); }
+
+    uint64_t underruns() const { return underruns_.load(std::memory_order_relaxed); }
+
+private:
+    static void callback(void* userdata, Uint8* stream, int len);
+
+    SpscRing<int16_t, 8192> ring_;
+    SDL_AudioDeviceID device_ = 0;
+    unsigned int sample_rate_ = 44100;
+    std::atomic<uint64_t> underruns_{0};
+};
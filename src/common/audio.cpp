@@ -0,0 +1,58 @@
+#include "common/audio.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+constexpr std::size_t CHUNK_SAMPLES = 512;  // 한 번에 합성하는 최대 샘플 수 (스택 버퍼 크기)
+}
+
+Beeper::Beeper(AudioSink& sink)
+    : sink_(sink),
+      target_queued_(sink.sample_rate() / 30),
+      fade_step_(1.0f / (sink.sample_rate() * 0.002f)) {}
+
+void Beeper::set_pattern(const uint8_t* pattern, uint8_t pitch) {
+    std::copy(pattern, pattern + pattern_.size(), pattern_.begin());
+    use_pattern_ = std::any_of(pattern_.begin(), pattern_.end(), [](uint8_t b) { return b != 0; });
+    pattern_rate_ = 4000.0 * std::pow(2.0, (static_cast<int>(pitch) - 64) / 48.0);
+}
+
+float Beeper::next_sample(bool active) {
+    // 목표 음량 쪽으로 조금씩 이동 (페이드 인/아웃)
+    float target = active ? 1.0f : 0.0f;
+    if (level_ < target) level_ = std::min(target, level_ + fade_step_);
+    else if (level_ > target) level_ = std::max(target, level_ - fade_step_);
+    if (level_ == 0.0f) return 0.0f;
+
+    const double rate = static_cast<double>(sink_.sample_rate());
+    bool high;
+    if (use_pattern_) {
+        unsigned int bit = static_cast<unsigned int>(phase_) & 127u;
+        high = (pattern_[bit >> 3] >> (7 - (bit & 7))) & 1;
+        phase_ += pattern_rate_ / rate;
+        if (phase_ >= 128.0) phase_ -= 128.0;
+    } else {
+        high = phase_ < 0.5;
+        phase_ += frequency_ / rate;
+        if (phase_ >= 1.0) phase_ -= 1.0;
+    }
+    return (high ? volume_ : -volume_) * level_;
+}
+
+void Beeper::pump(bool active) {
+    std::size_t queued = sink_.queued();
+    if (queued >= target_queued_) return;
+
+    // 소리가 완전히 꺼진 상태에서도 무음을 채워 둬야 다시 켤 때 지연이 일정하다
+    std::size_t missing = target_queued_ - queued;
+    int16_t buffer[CHUNK_SAMPLES];
+    while (missing > 0) {
+        std::size_t n = std::min(missing, CHUNK_SAMPLES);
+        for (std::size_t i = 0; i < n; ++i) {
+            buffer[i] = static_cast<int16_t>(next_sample(active) * 32767.0f);
+        }
+        if (sink_.submit(buffer, n) < n) break;  // 대기열이 가득 참: 다음 pump에서 이어서
+        missing -= n;
+    }
+}
@@ -0,0 +1,188 @@
+#include "common/capture.hpp"
+#include "common/log.hpp"
+
+#include <chrono>
+#include <cstring>
+
+namespace {
+
+constexpr std::size_t FILE_BUFFER_SIZE = 1 << 20;
+
+bool has_suffix(const std::string& text, const char* suffix) {
+    std::size_t n = std::strlen(suffix);
+    if (text.size() < n) return false;
+    for (std::size_t i = 0; i < n; ++i) {
+        char c = text[text.size() - n + i];
+        if (c >= 'A' && c <= 'Z') c = static_cast<char>(c - 'A' + 'a');
+        if (c != suffix[i]) return false;
+    }
+    return true;
+}
+
+// BT.601 제한 범위 RGB → YUV (Y4M 기본)
+void rgb_to_yuv(uint8_t r, uint8_t g, uint8_t b, uint8_t* yuv) {
+    yuv[0] = static_cast<uint8_t>(((66 * r + 129 * g + 25 * b + 128) >> 8) + 16);
+    yuv[1] = static_cast<uint8_t>(((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128);
+    yuv[2] = static_cast<uint8_t>(((112 * r - 94 * g - 18 * b + 128) >> 8) + 128);
+}
+
+} // namespace
+
+FrameCapture::~FrameCapture() {
+    close();
+}
+
+bool FrameCapture::open(const std::string& path, unsigned int width, unsigned int height, const Palette& palette) {
+    close();
+
+    file_ = std::fopen(path.c_str(), "wb");
+    if (!file_) {
+        LOG_ERROR(General, "Failed to open capture file: %s", path.c_str());
+        return false;
+    }
+    std::setvbuf(file_, nullptr, _IOFBF, FILE_BUFFER_SIZE);
+
+    format_ = has_suffix(path, ".y4m") ? Format::Y4m : Format::Raw;
+    width_ = width;
+    height_ = height;
+
+    // 픽셀 값 → 출력 바이트 LUT (Platform과 같은 규칙: 0~3은 팔레트, 4 이상은 전경)
+    for (unsigned int value = 0; value < 256; ++value) {
+        uint32_t rgba = palette.colors[value < palette.colors.size() ? value : 1];
+        uint8_t* out = &lut_[value * 4];
+        uint8_t r = static_cast<uint8_t>(rgba >> 24);
+        uint8_t g = static_cast<uint8_t>(rgba >> 16);
+        uint8_t b = static_cast<uint8_t>(rgba >> 8);
+        if (format_ == Format::Y4m) {
+            rgb_to_yuv(r, g, b, out);
+            out[3] = 0;
+        } else {
+            out[0] = r;
+            out[1] = g;
+            out[2] = b;
+            out[3] = 0xFF;
+        }
+    }
+
+    if (format_ == Format::Y4m) {
+        std::fprintf(file_, "YUV4MPEG2 W%u H%u F60:1 Ip A1:1 C444\n", width_, height_);
+        converted_.assign(static_cast<std::size_t>(width_) * height_ * 3, 0);
+    } else {
+        std::fprintf(file_, "CHIP8RAW %u %u 60\n", width_, height_);
+        converted_.assign(static_cast<std::size_t>(width_) * height_ * 4, 0);
+    }
+
+    has_last_ = false;
+    pending_repeats_ = 0;
+    frames_.store(0, std::memory_order_relaxed);
+    repeats_.store(0, std::memory_order_relaxed);
+    stalls_ = 0;
+
+    queue_ = std::make_unique<SpscRing<FrameBuffer, QUEUE_FRAMES>>();
+    running_.store(true, std::memory_order_release);
+    writer_ = std::thread([this] { run(); });
+    return true;
+}
+
+void FrameCapture::submit(const FrameView& frame) {
+    if (!file_) return;
+
+    staging_.assign(frame);
+    if (queue_->try_push(staging_)) return;
+
+    // writer가 밀린 경우에만 대기 (프레임을 버리지 않음)
+    ++stalls_;
+    while (!queue_->try_push(staging_)) {
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+}
+
+void FrameCapture::close() {
+    if (!file_) return;
+
+    running_.store(false, std::memory_order_release);
+    if (writer_.joinable()) writer_.join();
+
+    std::fclose(file_);
+    file_ = nullptr;
+    queue_.reset();
+}
+
+void FrameCapture::run() {
+    FrameBuffer frame;
+    while (true) {
+        if (queue_->try_pop(frame)) {
+            write_frame(frame);
+            continue;
+        }
+        if (!running_.load(std::memory_order_acquire)) {
+            // 종료 요청 후 남은 프레임까지 비웠으면 끝
+            if (queue_->size() == 0) break;
+            continue;
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+    flush_repeats();
+    std::fflush(file_);
+}
+
+void FrameCapture::write_frame(const FrameBuffer& frame) {
+    frames_.fetch_add(1, std::memory_order_relaxed);
+
+    const bool same = has_last_ && frame.width == last_.width && frame.height == last_.height &&
+                      std::memcmp(frame.pixels.data(), last_.pixels.data(), frame.width * frame.height) == 0;
+    if (same) {
+        repeats_.fetch_add(1, std::memory_order_relaxed);
+        if (format_ == Format::Raw) {
+            ++pending_repeats_;  // 반복이 끝날 때 한 레코드로 씀
+        } else {
+            std::fputs("FRAME\n", file_);
+            std::fwrite(converted_.data(), 1, converted_.size(), file_);
+        }
+        return;
+    }
+
+    last_.assign(frame.view());
+    has_last_ = true;
+    convert(frame);
+
+    if (format_ == Format::Raw) {
+        flush_repeats();
+        std::fputc('F', file_);
+    } else {
+        std::fputs("FRAME\n", file_);
+    }
+    std::fwrite(converted_.data(), 1, converted_.size(), file_);
+}
+
+void FrameCapture::flush_repeats() {
+    if (pending_repeats_ == 0) return;
+    uint8_t record[5] = {'R',
+                         static_cast<uint8_t>(pending_repeats_),
+                         static_cast<uint8_t>(pending_repeats_ >> 8),
+                         static_cast<uint8_t>(pending_repeats_ >> 16),
+                         static_cast<uint8_t>(pending_repeats_ >> 24)};
+    std::fwrite(record, 1, sizeof(record), file_);
+    pending_repeats_ = 0;
+}
+
+void FrameCapture::convert(const FrameBuffer& frame) {
+    if (frame.width == 0 || frame.height == 0) return;
+
+    const std::size_t plane = static_cast<std::size_t>(width_) * height_;
+    for (unsigned int y = 0; y < height_; ++y) {
+        const uint8_t* src = frame.pixels.data() + static_cast<std::size_t>(y * frame.height / height_) * frame.width;
+        const std::size_t row = static_cast<std::size_t>(y) * width_;
+        for (unsigned int x = 0; x < width_; ++x) {
+            const uint8_t* color = &lut_[src[x * frame.width / width_] * 4];
+            if (format_ == Format::Y4m) {
+                // 평면 순서: Y 전체, U 전체, V 전체
+                converted_[row + x] = color[0];
+                converted_[plane + row + x] = color[1];
+                converted_[2 * plane + row + x] = color[2];
+            } else {
+                std::memcpy(&converted_[(row + x) * 4], color, 4);
+            }
+        }
+    }
+}
@@ -0,0 +1,106 @@
+#include "common/log.hpp"
+
+#include <cstdarg>
+#include <cstdio>
+#include <sstream>
+
+namespace logging {
+
+namespace {
+
+thread_local const Sink* t_sink = nullptr;      // ScopedSink로 건 Sink
+std::atomic<const Sink*> g_default_sink{nullptr};
+
+const Sink* current_sink() {
+    return t_sink ? t_sink : g_default_sink.load(std::memory_order_acquire);
+}
+
+} // namespace
+
+ScopedSink::ScopedSink(const Sink* sink) : previous_(t_sink) {
+    t_sink = sink;
+}
+
+ScopedSink::~ScopedSink() {
+    t_sink = previous_;
+}
+
+void set_default_sink(const Sink* sink) {
+    g_default_sink.store(sink, std::memory_order_release);
+}
+
+bool enabled(Level level, Category category) {
+    const Sink* sink = current_sink();
+    return sink && sink->accepts(level, category);
+}
+
+void write(Level level, Category category, const char* fmt, ...) {
+    const Sink* sink = current_sink();
+    if (!sink || !sink->emit) return;
+
+    char text[MESSAGE_SIZE];
+    va_list args;
+    va_start(args, fmt);
+    std::vsnprintf(text, sizeof(text), fmt, args);
+    va_end(args);
+    sink->emit(sink->user, level, category, text);
+}
+
+const char* level_name(Level level) {
+    switch (level) {
+        case Level::Trace: return "TRACE";
+        case Level::Debug: return "DEBUG";
+        case Level::Info:  return "INFO";
+        case Level::Warn:  return "WARN";
+        case Level::Error: return "ERROR";
+        default:           return "OFF";
+    }
+}
+
+const char* category_name(Category category) {
+    switch (category) {
+        case Category::General:  return "general";
+        case Category::Cpu8:     return "cpu8";
+        case Category::Cpu32:    return "cpu32";
+        case Category::Video:    return "video";
+        case Category::Debugger: return "debugger";
+        case Category::Platform: return "platform";
+        default:                 return "?";
+    }
+}
+
+bool parse_level(const std::string& text, Level& level) {
+    for (uint8_t i = CHIP8_LOG_LEVEL_TRACE; i <= CHIP8_LOG_LEVEL_OFF; ++i) {
+        std::string name = level_name(static_cast<Level>(i));
+        for (char& c : name) c = static_cast<char>(c - 'A' + 'a');
+        if (text == name) {
+            level = static_cast<Level>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool parse_categories(const std::string& text, uint32_t& mask) {
+    uint32_t result = 0;
+    std::istringstream iss(text);
+    std::string name;
+    while (std::getline(iss, name, ',')) {
+        if (name == "all") {
+            result = ALL_CATEGORIES;
+            continue;
+        }
+        bool found = false;
+        for (uint32_t i = 0; i < static_cast<uint32_t>(Category::Count); ++i) {
+            if (name == category_name(static_cast<Category>(i))) {
+                result |= 1u << i;
+                found = true;
+            }
+        }
+        if (!found) return false;
+    }
+    mask = result;
+    return true;
+}
+
+} // namespace logging
@@ -0,0 +1,149 @@
+#include "common/log_console.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+namespace logging {
+
+namespace {
+
+constexpr std::size_t RING_CAPACITY = 1024;   // 슬롯 수 (2의 거듭제곱)
+
+static_assert((RING_CAPACITY & (RING_CAPACITY - 1)) == 0, "RING_CAPACITY must be a power of two");
+
+struct Slot {
+    std::atomic<uint64_t> sequence;
+    Level level;
+    Category category;
+    char text[MESSAGE_SIZE];
+};
+
+/**
+ * @brief 다중 생산자 / 단일 소비자 bounded 링 버퍼 + 출력 스레드
+ * 각 슬롯의 sequence 번호로 소유권을 넘기므로 락이 필요 없다.
+ *   sequence == pos         : 생산자가 쓸 수 있음
+ *   sequence == pos + 1     : 소비자가 읽을 수 있음
+ */
+class Logger {
+public:
+    Logger() {
+        for (std::size_t i = 0; i < RING_CAPACITY; ++i) {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        worker_ = std::thread([this] { run(); });
+    }
+
+    ~Logger() {
+        running_.store(false, std::memory_order_release);
+        if (worker_.joinable()) worker_.join();
+        drain();
+    }
+
+    void push(Level level, Category category, const char* text) {
+        uint64_t pos = tail_.load(std::memory_order_relaxed);
+        Slot* slot = nullptr;
+        while (true) {
+            slot = &slots_[pos & (RING_CAPACITY - 1)];
+            uint64_t seq = slot->sequence.load(std::memory_order_acquire);
+            int64_t diff = static_cast<int64_t>(seq) - static_cast<int64_t>(pos);
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);  // 가득 참: 버림
+                return;
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+
+        slot->level = level;
+        slot->category = category;
+        std::snprintf(slot->text, MESSAGE_SIZE, "%s", text);
+        slot->sequence.store(pos + 1, std::memory_order_release);
+    }
+
+    void flush() {
+        while (head_.load(std::memory_order_acquire) < tail_.load(std::memory_order_acquire)) {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+        std::fflush(stdout);
+        std::fflush(stderr);
+    }
+
+    uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    void run() {
+        while (running_.load(std::memory_order_acquire)) {
+            if (!drain()) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    /// @brief 준비된 메시지를 모두 출력 (하나라도 출력했으면 true)
+    bool drain() {
+        bool wrote = false;
+        uint64_t pos = head_.load(std::memory_order_relaxed);
+        while (true) {
+            Slot& slot = slots_[pos & (RING_CAPACITY - 1)];
+            if (slot.sequence.load(std::memory_order_acquire) != pos + 1) break;
+
+            std::FILE* out = slot.level >= Level::Warn ? stderr : stdout;
+            std::fprintf(out, "[%s][%s] %s\n", level_name(slot.level),
+                         category_name(slot.category), slot.text);
+
+            slot.sequence.store(pos + RING_CAPACITY, std::memory_order_release);
+            head_.store(++pos, std::memory_order_release);
+            wrote = true;
+        }
+        if (wrote) {
+            std::fflush(stdout);
+            std::fflush(stderr);
+        }
+        return wrote;
+    }
+
+    std::array<Slot, RING_CAPACITY> slots_;
+    alignas(64) std::atomic<uint64_t> tail_{0};
+    alignas(64) std::atomic<uint64_t> head_{0};
+    std::atomic<uint64_t> dropped_{0};
+    std::atomic<bool> running_{true};
+    std::thread worker_;
+};
+
+Logger& instance() {
+    static Logger logger;  // 첫 메시지에서 출력 스레드 시작
+    return logger;
+}
+
+void emit_console(void*, Level level, Category category, const char* text) {
+    instance().push(level, category, text);
+}
+
+Sink g_console{emit_console, nullptr};
+
+} // namespace
+
+void install_console() {
+    set_default_sink(&g_console);
+}
+
+void set_level(Level level) {
+    g_console.level.store(static_cast<uint8_t>(level), std::memory_order_relaxed);
+}
+
+void set_category_mask(uint32_t mask) {
+    g_console.categories.store(mask, std::memory_order_relaxed);
+}
+
+void flush() {
+    instance().flush();
+}
+
+uint64_t dropped_count() {
+    return instance().dropped();
+}
+
+} // namespace logging
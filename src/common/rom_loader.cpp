@@ -0,0 +1,146 @@
+#include "common/rom_loader.hpp"
+
+#include <cstdio>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define ROM_LOADER_POSIX 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+const char* rom_error_message(RomError error) {
+    switch (error) {
+        case RomError::None:           return "ok";
+        case RomError::OpenFailed:     return "cannot open file";
+        case RomError::NotRegularFile: return "not a regular file";
+        case RomError::ReadFailed:     return "read failed";
+        case RomError::Empty:          return "file is empty";
+        case RomError::TooLarge:       return "too large for program memory";
+    }
+    return "unknown error";
+}
+
+RomImage::~RomImage() {
+    close();
+}
+
+RomImage::RomImage(RomImage&& other) noexcept {
+    *this = std::move(other);
+}
+
+RomImage& RomImage::operator=(RomImage&& other) noexcept {
+    if (this == &other) return *this;
+    close();
+    map_ = other.map_;
+    size_ = other.size_;
+    buffer_ = std::move(other.buffer_);
+    data_ = map_ ? other.data_ : buffer_.data();
+    other.map_ = nullptr;
+    other.data_ = nullptr;
+    other.size_ = 0;
+    return *this;
+}
+
+void RomImage::close() {
+#ifdef ROM_LOADER_POSIX
+    if (map_) munmap(map_, size_);
+#endif
+    map_ = nullptr;
+    data_ = nullptr;
+    size_ = 0;
+    buffer_.clear();
+}
+
+#ifdef ROM_LOADER_POSIX
+
+RomError RomImage::open(const char* path, std::size_t max_size) {
+    close();
+
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0) return RomError::OpenFailed;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        ::close(fd);
+        return RomError::ReadFailed;
+    }
+    if (!S_ISREG(st.st_mode)) {
+        ::close(fd);
+        return RomError::NotRegularFile;
+    }
+    if (st.st_size == 0) {
+        ::close(fd);
+        return RomError::Empty;
+    }
+    if (static_cast<uint64_t>(st.st_size) > max_size) {
+        ::close(fd);
+        return RomError::TooLarge;
+    }
+    const std::size_t size = static_cast<std::size_t>(st.st_size);
+
+    // 읽기 전용 매핑 (실패하면 read로 대체)
+    void* map = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map != MAP_FAILED) {
+        ::close(fd);
+        map_ = map;
+        data_ = static_cast<const uint8_t*>(map);
+        size_ = size;
+        return RomError::None;
+    }
+
+    buffer_.resize(size);
+    std::size_t done = 0;
+    while (done < size) {
+        ssize_t n = ::read(fd, buffer_.data() + done, size - done);
+        if (n <= 0) {
+            ::close(fd);
+            buffer_.clear();
+            return RomError::ReadFailed;
+        }
+        done += static_cast<std::size_t>(n);
+    }
+    ::close(fd);
+    data_ = buffer_.data();
+    size_ = size;
+    return RomError::None;
+}
+
+#else
+
+RomError RomImage::open(const char* path, std::size_t max_size) {
+    close();
+
+    std::FILE* file = std::fopen(path, "rb");
+    if (!file) return RomError::OpenFailed;
+
+    long size = -1;
+    if (std::fseek(file, 0, SEEK_END) == 0) size = std::ftell(file);
+    if (size < 0 || std::fseek(file, 0, SEEK_SET) != 0) {
+        std::fclose(file);
+        return RomError::ReadFailed;
+    }
+    if (size == 0) {
+        std::fclose(file);
+        return RomError::Empty;
+    }
+    if (static_cast<uint64_t>(size) > max_size) {
+        std::fclose(file);
+        return RomError::TooLarge;
+    }
+
+    buffer_.resize(static_cast<std::size_t>(size));
+    const bool ok = std::fread(buffer_.data(), 1, buffer_.size(), file) == buffer_.size();
+    std::fclose(file);
+    if (!ok) {
+        buffer_.clear();
+        return RomError::ReadFailed;
+    }
+    data_ = buffer_.data();
+    size_ = buffer_.size();
+    return RomError::None;
+}
+
+#endif
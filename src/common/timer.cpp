@@ -0,0 +1,64 @@
+#include "timer.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+
+namespace timer {
+    uint64_t now_ns() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    // get_ticks 기준 시각 (프로그램 시작)
+    static const uint64_t g_start_ns = now_ns();
+
+    uint32_t get_ticks() {
+        return static_cast<uint32_t>((now_ns() - g_start_ns) / NS_PER_MS);
+    }
+
+    void delay(uint32_t ms) {
+        sleep_until_ns(now_ns() + ms * NS_PER_MS);
+    }
+
+    uint64_t sleep_until_ns(uint64_t deadline) {
+        uint64_t now = now_ns();
+        // 1단계: 마지막 구간을 남기고 OS sleep
+        while (now + SPIN_THRESHOLD_NS < deadline) {
+            std::this_thread::sleep_for(std::chrono::nanoseconds(deadline - now - SPIN_THRESHOLD_NS));
+            now = now_ns();
+        }
+        // 2단계: 남은 구간은 yield하며 대기 (다른 스레드에 CPU를 양보하면서 sub-ms 정확도 확보)
+        while (now < deadline) {
+            std::this_thread::yield();
+            now = now_ns();
+        }
+        return now;
+    }
+
+    void JitterStats::record(int64_t jitter_ns) {
+        if (frames == 0 || jitter_ns > max_ns) max_ns = jitter_ns;
+        if (frames == 0 || jitter_ns < min_ns) min_ns = jitter_ns;
+        ++frames;
+        mean_abs_ns += (static_cast<double>(std::llabs(jitter_ns)) - mean_abs_ns) / static_cast<double>(frames);
+    }
+
+    FramePacer::FramePacer(uint64_t period_ns)
+        : period_ns_(period_ns), deadline_(now_ns() + period_ns) {}
+
+    void FramePacer::wait() {
+        uint64_t woke = sleep_until_ns(deadline_);
+        stats_.record(static_cast<int64_t>(woke - deadline_));
+
+        deadline_ += period_ns_;
+        if (woke >= deadline_) {
+            // 한 주기 이상 밀림: 밀린 프레임을 몰아 돌리지 않고 기준을 다시 잡음
+            ++stats_.late_frames;
+            deadline_ = woke + period_ns_;
+        }
+    }
+
+    void FramePacer::restart() {
+        deadline_ = now_ns() + period_ns_;
+    }
+}
@@ -1,10 +1,9 @@
 #include "chip8.hpp"
 #include "opcode_table.hpp"
-#include <cstring> // memset, memcpy
-#include <random>  // for CXNN
-#include <fstream>
-#include <vector>
-#include <iostream>
+#include "common/log.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring> // memset, memcpy, memmove
 
 // 기본 폰트셋 (각 숫자는 4x5 픽셀로 구성됨)
 // 0x000 ~ 0x050 주소에 로드됨
@@ -27,86 +26,123 @@ static const uint8_t chip8_fontset[80] = {
     0xF0, 0x80, 0xF0, 0x80, 0x80  // F
 };
 
+// SUPER-CHIP / XO-CHIP 큰 폰트 (각 숫자는 8x10 픽셀, FX30)
+// 0x050 ~ 0x0F0 주소에 로드됨
+static const uint8_t schip_big_fontset[160] = {
+    0x3C, 0x7E, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7, 0x7E, 0x3C, // 0
+    0x18, 0x38, 0x58, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3C, // 1
+    0x3E, 0x7F, 0xC3, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xFF, 0xFF, // 2
+    0x3C, 0x7E, 0xC3, 0x03, 0x0E, 0x0E, 0x03, 0xC3, 0x7E, 0x3C, // 3
+    0x06, 0x0E, 0x1E, 0x36, 0x66, 0xC6, 0xFF, 0xFF, 0x06, 0x06, // 4
+    0xFF, 0xFF, 0xC0, 0xC0, 0xFC, 0xFE, 0x03, 0xC3, 0x7E, 0x3C, // 5
+    0x3E, 0x7C, 0xE0, 0xC0, 0xFC, 0xFE, 0xC3, 0xC3, 0x7E, 0x3C, // 6
+    0xFF, 0xFF, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x60, 0x60, // 7
+    0x3C, 0x7E, 0xC3, 0xC3, 0x7E, 0x7E, 0xC3, 0xC3, 0x7E, 0x3C, // 8
+    0x3C, 0x7E, 0xC3, 0xC3, 0x7F, 0x3F, 0x03, 0x03, 0x3E, 0x7C, // 9
+    0x7E, 0xFF, 0xC3, 0xC3, 0xC3, 0xFF, 0xFF, 0xC3, 0xC3, 0xC3, // A
+    0xFC, 0xFC, 0xC3, 0xC3, 0xFC, 0xFC, 0xC3, 0xC3, 0xFC, 0xFC, // B
+    0x3C, 0xFF, 0xC3, 0xC0, 0xC0, 0xC0, 0xC0, 0xC3, 0xFF, 0x3C, // C
+    0xFC, 0xFE, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xFE, 0xFC, // D
+    0xFF, 0xFF, 0xC0, 0xC0, 0xFF, 0xFF, 0xC0, 0xC0, 0xFF, 0xFF, // E
+    0xFF, 0xFF, 0xC0, 0xC0, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0  // F
+};
+
 // 생성자 - 에뮬레이터 초기화
 Chip8::Chip8() {
+    memory_size_ = MEMORY_SIZE;
     reset();
 }
 
 // 초기 상태로 리셋
 void Chip8::reset() {
-    pc = 0x200;  // 프로그램 시작 주소
-    opcode = 0;
-    I = 0;       // 인덱스 레지스터
-    sp = 0;      // 스택 포인터
-
-    // 모든 메모리, 레지스터, 화면, 키보드 초기화
-    std::memset(memory.data(), 0, sizeof(memory));
-    std::memset(V.data(), 0, sizeof(V));
-    std::memset(video.data(), 0, sizeof(video));
-    std::memset(stack.data(), 0, sizeof(stack));
-    std::memset(keypad.data(), 0, sizeof(keypad));
-
-    delay_timer = 0;
-    sound_timer = 0;
-
-    // 메모리 0x000~0x050에 폰트셋 복사
-    std::memcpy(memory.data(), chip8_fontset, sizeof(chip8_fontset));
-
-    draw_flag = false;  // 화면 다시 그릴 필요 없음
-}
-
-// ROM 파일을 메모리에 로드 (0x200부터)
-bool Chip8::load_rom(const char* filename) {
-    std::ifstream rom(filename, std::ios::binary | std::ios::ate);
-    if (!rom.is_open()) return false;
-
-    std::streamsize size = rom.tellg();     // 파일 크기 구함
-    rom.seekg(0, std::ios::beg);            // 파일 처음으로 이동
-    std::vector<char> buffer(size);         // 버퍼에 ROM 데이터 담기
-    if (!rom.read(buffer.data(), size)) return false;
-
-    // 0x200부터 메모리에 ROM 데이터 복사
-    for (size_t i = 0; i < static_cast<size_t>(size); ++i) {
-        memory[0x200 + i] = static_cast<uint8_t>(buffer[i]);
+    reset_machine();  // pc = 0x200, 메모리/레지스터/화면/스택/키보드/타이머 초기화
+    planes_ = 1;
+    audio_pitch_ = 64;
+    rpl_.fill(0);
+    audio_pattern_.fill(0);
+
+    // 메모리 0x000~0x050에 폰트셋 복사 (확장 방언은 0x050~0x0F0에 큰 폰트도 복사)
+    std::memcpy(memory.data() + FONT_ADDRESS, chip8_fontset, sizeof(chip8_fontset));
+    if (dialect_ != Dialect::Chip8) {
+        std::memcpy(memory.data() + BIG_FONT_ADDRESS, schip_big_fontset, sizeof(schip_big_fontset));
     }
-
-    return true;
 }
 
 // 하나의 사이클 수행: Fetch → Decode → Execute
 void Chip8::cycle() {
+    if (halted_) return;  // 00FD 이후에는 실행하지 않음
+
     // 1. Fetch (pc가 가리키는 주소에서 2바이트(opcode)를 가져와서 하나의 명령어로 만듦)
-    opcode = (memory[pc] << 8) | memory[pc + 1];
+    opcode = (memory[pc] << 8) | memory[static_cast<uint16_t>(pc + 1)];
     // 2. Decode + Execute ( opcode를 보고 어떤 명령인지 해석 후, 해당 명령에 맞는 함수 실행)
     OpcodeTable::Execute(*this, opcode);
 }
 
-// 화면이 그려져야 하는지 여부를 외부에 알림
-bool Chip8::needs_redraw() const {
-    return draw_flag;
-}
-
-// 화면 플래그 초기화 (draw 완료됨)
-void Chip8::clear_draw_flag() {
-    draw_flag = false;
-}
-
-// 화면 버퍼 읽기 (렌더링용)
-const uint8_t* Chip8::get_video_buffer() const {
-    return video.data();
+// 방언 선택: 디스패치 테이블을 한 번 골라 두고 메모리 크기를 맞춘 뒤 초기화
+void Chip8::set_dialect(Dialect dialect) {
+    dialect_ = dialect;
+    dispatch_ = &OpcodeTable::Table(dialect, quirks_);
+    memory_size_ = dialect == Dialect::XoChip ? MEMORY_SIZE_XO : MEMORY_SIZE;
+    reset();
+    LOG_DEBUG(Cpu8, "Dialect: %s (%u bytes memory)", dialect_name(dialect), memory_size_);
 }
 
-// 키보드 상태 배열 포인터 반환
-uint8_t* Chip8::get_keypad() {
-    return keypad.data();
+// 저해상도(64x32) / 고해상도(128x64) 전환
+void Chip8::set_hires(bool enable) {
+    video_width_ = enable ? VIDEO_WIDTH_HI : VIDEO_WIDTH;
+    video_height_ = enable ? VIDEO_HEIGHT_HI : VIDEO_HEIGHT;
+    video.fill(0);
+    draw_flag = true;
 }
 
-// 스택 접근
-uint16_t& Chip8::stack_at(uint8_t index) { 
-    return stack[index]; 
-}
+// 선택된 평면 스크롤
+// 선택된 평면이 화면의 모든 평면을 덮으면(CHIP-8/SUPER-CHIP은 항상) 행 단위 memmove로 처리하고,
+// XO-CHIP에서 일부 평면만 선택된 경우에만 픽셀 단위로 평면 비트를 섞는다.
+void Chip8::scroll(int dx, int dy) {
+    const int w = static_cast<int>(video_width_);
+    const int h = static_cast<int>(video_height_);
+    uint8_t* pixels = video.data();
+    const uint8_t all_planes = dialect_ == Dialect::XoChip ? 0x3 : 0x1;
+
+    if ((planes_ & all_planes) == all_planes) {
+        if (dy != 0) {
+            int n = std::min(std::abs(dy), h);
+            if (dy > 0) {
+                std::memmove(pixels + n * w, pixels, static_cast<size_t>((h - n) * w));
+                std::memset(pixels, 0, static_cast<size_t>(n * w));
+            } else {
+                std::memmove(pixels, pixels + n * w, static_cast<size_t>((h - n) * w));
+                std::memset(pixels + (h - n) * w, 0, static_cast<size_t>(n * w));
+            }
+        }
+        if (dx != 0) {
+            int n = std::min(std::abs(dx), w);
+            for (int row = 0; row < h; ++row) {
+                uint8_t* line = pixels + row * w;
+                if (dx > 0) {
+                    std::memmove(line + n, line, static_cast<size_t>(w - n));
+                    std::memset(line, 0, static_cast<size_t>(n));
+                } else {
+                    std::memmove(line, line + n, static_cast<size_t>(w - n));
+                    std::memset(line + (w - n), 0, static_cast<size_t>(n));
+                }
+            }
+        }
+        return;
+    }
 
-// 화면 버퍼 참조 반환 (픽셀 조작용)
-std::array<uint8_t, VIDEO_WIDTH * VIDEO_HEIGHT>& Chip8::get_video() {
-    return video;
+    // 일부 평면만 스크롤: 원본을 복사해 두고 선택 평면 비트만 이동한 위치에서 가져옴
+    const uint8_t mask = planes_;
+    std::array<uint8_t, VIDEO_WIDTH_HI * VIDEO_HEIGHT_HI> source;
+    std::memcpy(source.data(), pixels, static_cast<size_t>(w * h));
+    for (int row = 0; row < h; ++row) {
+        for (int col = 0; col < w; ++col) {
+            int src_row = row - dy;
+            int src_col = col - dx;
+            uint8_t moved = (src_row >= 0 && src_row < h && src_col >= 0 && src_col < w)
+                                ? source[src_row * w + src_col] : 0;
+            uint8_t& pixel = pixels[row * w + col];
+            pixel = static_cast<uint8_t>((pixel & ~mask) | (moved & mask));
+        }
+    }
 }
\ No newline at end of file
@@ -1,10 +1,8 @@
 #include "chip8_32.hpp"
 #include "opcode_table_32.hpp"
+#include "common/log.hpp"
+#include "common/byte_order.hpp"
 #include <cstring> // memset, memcpy
-#include <random>  // for CXNN
-#include <fstream>
-#include <vector>
-#include <iostream>
 
 // 기본 폰트셋 (각 숫자는 4x5 픽셀로 구성됨)
 // 0x000 ~ 0x050 주소에 로드됨
@@ -29,86 +27,58 @@ static const uint8_t chip8_fontset[80] = {
 
 // 생성자 : reset() 호출로 초기화
 Chip8_32::Chip8_32() {
-    loaded_rom_size = 0;
-    last_timer_update = 0;
     reset();
 }
 
 void Chip8_32::reset() {
-    pc = 0x200;  // 프로그램 시작 주소
-    opcode = 0;
-    I = 0;
-    sp = 0;
-
-    memory.fill(0);
-    R.fill(0);
-    video.fill(0);
-    stack.fill(0);
-    keypad.fill(0);
-
-    delay_timer = 0;
-    sound_timer = 0;
+    reset_machine();  // pc = 0x200, 메모리/레지스터/화면/스택/키보드/타이머 초기화
+    video_mode_ = VideoMode32::Low;
 
     std::memcpy(memory.data() + 0x50, chip8_fontset, sizeof(chip8_fontset));
-    draw_flag = false;
 
-    std::cout << "32-bit CHIP-8 system reset complete" << std::endl;
+    LOG_DEBUG(Cpu32, "32-bit CHIP-8 system reset complete");
 }
 
-bool Chip8_32::load_rom(const char* filename) {
-    std::ifstream rom(filename, std::ios::binary | std::ios::ate);
-    if (!rom.is_open()) {
-        std::cerr << "Failed to open ROM file: " << filename << std::endl;
-        return false;
-    }
-
-    std::streamsize size = rom.tellg();
-    loaded_rom_size = static_cast<size_t>(size);
-    rom.seekg(0, std::ios::beg);
-
-    if (size <= 0 || size > MEMORY_SIZE_32 - 0x200) {
-        std::cerr << "ROM size invalid or too large: " << size << std::endl;
-        return false;
-    }
-
-    std::vector<char> buffer(size);
-    if (!rom.read(buffer.data(), size)) {
-        std::cerr << "Failed to read ROM file: " << filename << std::endl;
-        return false;
-    }
+void Chip8_32::cycle() {
+    if (halted_) return;
 
-    for (size_t i = 0; i < static_cast<size_t>(size); ++i) {
-        memory[0x200 + i] = static_cast<uint8_t>(buffer[i]);
+    // 1. Fetch : 현재 pc 위치에서 4바이트 명령어를 읽음
+    //    PC 유효성은 분기 시점(jump_to)에만 검사하고, 순차 진행으로 끝을 넘는 경우는 주소 공간을 순환한다.
+    uint32_t addr = pc & (MEMORY_SIZE_32 - 1);
+    if ((addr & 3) == 0) {
+        // 4바이트 정렬: 32비트 로드 한 번 + byteswap
+        opcode = load_be32(memory.data() + addr);
+    } else {
+        opcode = (static_cast<uint32_t>(memory[addr]) << 24) |
+                 (memory[(addr + 1) & (MEMORY_SIZE_32 - 1)] << 16) |
+                 (memory[(addr + 2) & (MEMORY_SIZE_32 - 1)] << 8) |
+                 memory[(addr + 3) & (MEMORY_SIZE_32 - 1)];
     }
 
-    std::cout << "Loaded ROM: " << filename << " (" << size << " bytes)" << std::endl;
-    return true;
+    // 2. Decode & Execute : opcode 테이블을 통해 명령어 실행
+    OpcodeTable_32::Execute(*this, opcode);
 }
 
-void Chip8_32::cycle() {
-    if (pc >= MEMORY_SIZE_32 - 3) {
-        std::cerr << "PC out of bounds: " << pc << std::endl;
+// 분기 대상 검증: 메모리 밖이면 실행을 멈춤 (매 사이클 PC 검사 대신 제어 흐름이 바뀔 때만 확인)
+void Chip8_32::jump_to(uint32_t target) {
+    if (target > MEMORY_SIZE_32 - 4) {
+        LOG_ERROR(Cpu32, "Jump target out of bounds: 0x%X (from PC=0x%X), halting", target, pc);
+        halted_ = true;
         return;
     }
+    pc = target;
+}
 
-    // 1. Fetch : 현재 pc 위치에서 4바이트 명령어를 읽음
-    opcode = (memory[pc] << 24) | (memory[pc + 1] << 16) |
-             (memory[pc + 2] << 8) | memory[pc + 3];
+void Chip8_32::set_video_mode(VideoMode32 mode) {
+    static constexpr unsigned int widths[] = {64, 128, 256};
+    static constexpr unsigned int heights[] = {32, 64, 128};
+    unsigned int index = static_cast<unsigned int>(mode);
 
-    // 2. Decode & Execute : opcode 테이블을 통해 명령어 실행
-    OpcodeTable_32::Execute(*this, opcode);
+    video_mode_ = mode;
+    video_width_ = widths[index];
+    video_height_ = heights[index];
+    video.fill(0);
+    draw_flag = true;
 
-    uint32_t current_time = timer::get_ticks();
-    if (current_time - last_timer_update >= 16) {
-        if (delay_timer > 0) --delay_timer;
-        if (sound_timer > 0) --sound_timer;
-        last_timer_update = current_time;
-    }
+    LOG_DEBUG(Video, "32-bit video mode: %ux%u", video_width_, video_height_);
 }
-
-bool Chip8_32::needs_redraw() const { return draw_flag; }
-void Chip8_32::clear_draw_flag() { draw_flag = false; }
-const uint8_t* Chip8_32::get_video_buffer() const { return video.data(); }
-uint8_t* Chip8_32::get_keypad() { return keypad.data(); }
-uint32_t& Chip8_32::stack_at(uint8_t index) { return stack[index]; }
-std::array<uint8_t, VIDEO_WIDTH * VIDEO_HEIGHT>& Chip8_32::get_video() { return video; }
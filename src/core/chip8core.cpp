@@ -0,0 +1,198 @@
+#include "chip8core.h"
+#include "chip8.hpp"
+#include "chip8_32.hpp"
+#include "machine.hpp"
+#include "opcode_table.hpp"
+#include "opcode_table_32.hpp"
+#include "common/log.hpp"
+
+#include <exception>
+#include <memory>
+#include <mutex>
+
+// 인스턴스 하나 = 머신 하나 (코어 고유 설정용으로 구체 타입 포인터도 보관)
+struct chip8core {
+    int kind = CHIP8CORE_KIND_CHIP8;
+    std::unique_ptr<Machine> machine;
+    Chip8* chip8 = nullptr;         // 8비트 코어일 때만
+    Chip8_32* chip8_32 = nullptr;   // 32비트 코어일 때만
+    InputScheduler input;           // 예약된 입력 없음 (키는 chip8core_set_key로 바로 반영)
+    chip8core_log_fn log_callback = nullptr;
+    void* log_user = nullptr;
+    logging::Sink log;              // 코어 호출 동안 이 스레드의 로그를 받음 (콜백이 없으면 버림)
+};
+
+struct chip8core_snapshot {
+    int kind;
+    std::unique_ptr<Machine> machine;
+};
+
+namespace {
+
+// 디스패치 테이블은 모든 인스턴스가 읽기 전용으로 공유 (처음 만들 때 한 번만 채움)
+void initialize_tables() {
+    static std::once_flag once;
+    std::call_once(once, [] {
+        OpcodeTable::Initialize();
+        OpcodeTable_32::Initialize();
+    });
+}
+
+void emit_log(void* user, logging::Level level, logging::Category category, const char* text) {
+    const auto* core = static_cast<const chip8core*>(user);
+    core->log_callback(core->log_user, static_cast<int>(level), logging::category_name(category), text);
+}
+
+} // namespace
+
+extern "C" {
+
+chip8core* chip8core_create(int kind) {
+    if (kind != CHIP8CORE_KIND_CHIP8 && kind != CHIP8CORE_KIND_CHIP8_32) return nullptr;
+    // 할당 실패(bad_alloc) 등 예외는 C 호출자에게 넘기지 않고 NULL로
+    try {
+        initialize_tables();
+
+        auto core = std::make_unique<chip8core>();
+        logging::ScopedSink scope(&core->log);
+        core->kind = kind;
+        if (kind == CHIP8CORE_KIND_CHIP8) {
+            auto machine = std::make_unique<CoreMachine<Chip8>>("8-bit CHIP-8");
+            core->chip8 = &machine->core();
+            core->machine = std::move(machine);
+        } else {
+            auto machine = std::make_unique<CoreMachine<Chip8_32>>("32-bit CHIP-8");
+            core->chip8_32 = &machine->core();
+            core->machine = std::move(machine);
+        }
+        return core.release();
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void chip8core_destroy(chip8core* core) {
+    delete core;
+}
+
+int chip8core_kind(const chip8core* core) {
+    return core ? core->kind : -1;
+}
+
+int chip8core_set_dialect(chip8core* core, int dialect) {
+    if (!core || !core->chip8 || dialect < 0 || dialect >= static_cast<int>(NUM_DIALECTS)) return CHIP8CORE_ERROR_ARGUMENT;
+    logging::ScopedSink scope(&core->log);
+    core->chip8->set_dialect(static_cast<Dialect>(dialect));
+    return CHIP8CORE_OK;
+}
+
+int chip8core_set_quirks(chip8core* core, unsigned int quirks) {
+    if (!core || !core->chip8 || quirks >= NUM_QUIRK_SETS) return CHIP8CORE_ERROR_ARGUMENT;
+    logging::ScopedSink scope(&core->log);
+    Quirks q;
+    q.shift_vy = (quirks & QUIRK_SHIFT) != 0;
+    q.memory_i = (quirks & QUIRK_MEMORY) != 0;
+    q.vf_reset = (quirks & QUIRK_VF_RESET) != 0;
+    q.clip = (quirks & QUIRK_CLIP) != 0;
+    q.jump_vx = (quirks & QUIRK_JUMP) != 0;
+    core->chip8->set_quirks(q);
+    return CHIP8CORE_OK;
+}
+
+void chip8core_set_seed(chip8core* core, uint32_t seed) {
+    if (!core) return;
+    if (core->chip8) core->chip8->set_seed(seed);
+    else core->chip8_32->set_seed(seed);
+}
+
+int chip8core_load_rom(chip8core* core, const uint8_t* data, size_t size) {
+    if (!core || (!data && size)) return CHIP8CORE_ERROR_ARGUMENT;
+    logging::ScopedSink scope(&core->log);
+    return static_cast<int>(core->machine->load(data, size));
+}
+
+void chip8core_reset(chip8core* core) {
+    if (!core) return;
+    logging::ScopedSink scope(&core->log);
+    if (core->chip8) core->chip8->reset();
+    else core->chip8_32->reset();
+}
+
+uint32_t chip8core_run(chip8core* core, uint32_t cycles) {
+    if (!core) return 0;
+    logging::ScopedSink scope(&core->log);
+    const uint64_t before = core->machine->stats().instructions;
+    try {
+        return core->machine->run_batch(cycles, core->input);
+    } catch (const std::exception& e) {
+        // 메모리 범위 밖 접근 등: 예외를 C 호출자에게 넘기지 않고 실행을 멈춤 (예외 전까지 실행한 수는 돌려줌)
+        LOG_ERROR(General, "%s halted: %s", core->machine->name(), e.what());
+        core->machine->halt();
+        return static_cast<uint32_t>(core->machine->stats().instructions - before);
+    }
+}
+
+void chip8core_tick_timers(chip8core* core) {
+    if (core) core->machine->tick_timers();
+}
+
+int chip8core_is_halted(const chip8core* core) {
+    return core && core->machine->is_halted() ? 1 : 0;
+}
+
+int chip8core_sound_active(const chip8core* core) {
+    return core && core->machine->sound().active ? 1 : 0;
+}
+
+const uint8_t* chip8core_framebuffer(const chip8core* core, unsigned int* width, unsigned int* height) {
+    if (!core) return nullptr;
+    const FrameView frame = core->machine->frame();
+    if (width) *width = frame.width;
+    if (height) *height = frame.height;
+    return frame.pixels;
+}
+
+int chip8core_frame_changed(chip8core* core, int clear) {
+    if (!core) return 0;
+    const bool changed = core->machine->needs_redraw();
+    if (clear) core->machine->clear_draw_flag();
+    return changed ? 1 : 0;
+}
+
+int chip8core_set_key(chip8core* core, unsigned int key, int pressed) {
+    if (!core || key >= NUM_KEYS) return CHIP8CORE_ERROR_ARGUMENT;
+    core->machine->keypad()[key] = pressed ? 1 : 0;
+    return CHIP8CORE_OK;
+}
+
+chip8core_snapshot* chip8core_snapshot_create(const chip8core* core) {
+    if (!core) return nullptr;
+    try {
+        return new chip8core_snapshot{core->kind, core->machine->snapshot()};
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+int chip8core_snapshot_restore(chip8core* core, const chip8core_snapshot* snapshot) {
+    if (!core || !snapshot) return CHIP8CORE_ERROR_ARGUMENT;
+    logging::ScopedSink scope(&core->log);
+    if (!core->machine->restore(*snapshot->machine)) return CHIP8CORE_ERROR_ARGUMENT;
+    return CHIP8CORE_OK;
+}
+
+void chip8core_snapshot_destroy(chip8core_snapshot* snapshot) {
+    delete snapshot;
+}
+
+int chip8core_set_log_callback(chip8core* core, chip8core_log_fn callback, void* user, int min_level) {
+    if (!core || min_level < CHIP8CORE_LOG_TRACE || min_level > CHIP8CORE_LOG_OFF) return CHIP8CORE_ERROR_ARGUMENT;
+    core->log_callback = callback;
+    core->log_user = user;
+    core->log.user = core;
+    core->log.emit = callback ? emit_log : nullptr;
+    core->log.level.store(static_cast<uint8_t>(min_level), std::memory_order_relaxed);
+    return CHIP8CORE_OK;
+}
+
+} // extern "C"
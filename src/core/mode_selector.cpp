@@ -1,201 +1,451 @@
 #include "mode_selector.hpp"
 #include "chip8.hpp"
 #include "chip8_32.hpp"
+#include "machine.hpp"
 #include "opcode_table.hpp"
 #include "opcode_table_32.hpp"
-#include "platform.hpp"
+#include "render_thread.hpp"
+#include "sdl_audio.hpp"
+#include "common/audio.hpp"
+#include "common/capture.hpp"
+#include "common/log.hpp"
 #include "timer.hpp"
 #include "debugger/debugger.hpp"
+#include "debugger/disassembler.hpp"
 #include <iostream>
+#include <vector>
 #include <algorithm>
+#include <functional>
+#include <memory>
 
 // 전역 변수로 디버그 모드 플래그
 static bool g_debug_mode = false;
 
+// 코어 / 8비트 방언 강제 지정 (지정하지 않으면 ROM 내용으로 판별)
+static bool g_rom_kind_forced = false;
+static RomKind g_rom_kind = RomKind::Chip8;
+static bool g_dialect_forced = false;
+static Dialect g_dialect = Dialect::Chip8;
+
 void ModeSelector::set_debug_mode(bool enable) {
     g_debug_mode = enable;
 }
 
+void ModeSelector::set_dialect(Dialect dialect) {
+    g_dialect = dialect;
+    g_dialect_forced = true;
+}
+
+void ModeSelector::set_rom_kind(RomKind kind) {
+    g_rom_kind = kind;
+    g_rom_kind_forced = true;
+}
+
+// 오디오 출력 사용 여부
+static bool g_audio_enabled = true;
+
+void ModeSelector::set_audio_enabled(bool enable) {
+    g_audio_enabled = enable;
+}
+
+// 화면 색
+static Palette g_palette;
+
+void ModeSelector::set_palette(const Palette& palette) {
+    g_palette = palette;
+}
+
+// 키 매핑
+static Keymap g_keymap;
+
+void ModeSelector::set_keymap(const Keymap& keymap) {
+    g_keymap = keymap;
+}
+
+// 터보 모드로 시작 (실행 중에는 Tab 키로 전환)
+static bool g_turbo = false;
+
+void ModeSelector::set_turbo(bool enable) {
+    g_turbo = enable;
+}
+
+// 헤드리스 실행 / 프레임 수 제한 / 캡처 파일
+static bool g_headless = false;
+static uint64_t g_max_frames = 0;
+static std::string g_capture_path;
+
+void ModeSelector::set_headless(bool enable) {
+    g_headless = enable;
+}
+
+void ModeSelector::set_max_frames(uint64_t frames) {
+    g_max_frames = frames;
+}
+
+void ModeSelector::set_capture_path(const std::string& path) {
+    g_capture_path = path;
+}
+
+// ROM 프로필 데이터베이스 경로 (비어 있으면 ROM 디렉토리의 romdb.txt) / 모르는 ROM 기록 여부
+static std::string g_romdb_path;
+static bool g_romdb_record = false;
+
+void ModeSelector::set_rom_database(const std::string& path) {
+    g_romdb_path = path;
+}
+
+void ModeSelector::set_record_unknown_roms(bool enable) {
+    g_romdb_record = enable;
+}
+
+// 8비트 동작 차이 강제 지정 (지정하지 않으면 ROM 프로필, 프로필도 없으면 기본 동작)
+static bool g_quirks_forced = false;
+static Quirks g_quirks;
+
+void ModeSelector::set_quirks(const Quirks& quirks) {
+    g_quirks = quirks;
+    g_quirks_forced = true;
+}
+
+// 프레임당 명령어 수 (0 = ROM 프로필 또는 모드별 기본값)
+static unsigned int g_ipf = 0;
+
+void ModeSelector::set_instructions_per_frame(unsigned int ipf) {
+    g_ipf = ipf;
+}
+
+// 디버그 모드도 같은 값 (단계 실행 중에는 디버거가 프레임마다 한 명령어로 줄임)
+static unsigned int instructions_per_frame(unsigned int default_ipf) {
+    return g_ipf ? g_ipf : default_ipf;
+}
+
+// 종료 시 프레임 페이싱 지터 통계 출력
+static void print_pacing_stats(const timer::FramePacer& pacer) {
+    const timer::JitterStats& stats = pacer.stats();
+    if (stats.frames == 0) return;
+    std::cout << "[INFO] Frame pacing: " << stats.frames << " frames, jitter mean "
+              << stats.mean_abs_ns / 1000.0 << "us, max " << stats.max_ns / 1000 << "us, "
+              << stats.late_frames << " late" << std::endl;
+}
+
+// 캡처 파일 열기 (width x height 크기로 기록)
+static bool open_capture(FrameCapture& capture, unsigned int width, unsigned int height) {
+    if (!capture.open(g_capture_path, width, height, g_palette)) {
+        std::cerr << "[ERROR] Failed to open capture file: " << g_capture_path << std::endl;
+        return false;
+    }
+    std::cout << "[INFO] Capturing " << width << "x" << height << " "
+              << (capture.format() == FrameCapture::Format::Y4m ? "Y4M" : "raw RGBA")
+              << " to " << g_capture_path << std::endl;
+    return true;
+}
+
+static void print_capture_stats(FrameCapture& capture) {
+    if (!capture.is_open()) return;
+    uint64_t stalls = capture.stalls();
+    capture.close();
+    std::cout << "[INFO] Captured " << capture.frames() << " frames (" << capture.repeats()
+              << " repeated, " << stalls << " writer stalls)" << std::endl;
+}
+
+// SDL 오디오 장치를 열고, 꺼져 있거나 실패하면 무음 출력으로 대체 (헤드리스면 항상 무음)
+static std::unique_ptr<AudioSink> create_audio_sink() {
+    if (g_audio_enabled && !g_headless) {
+        auto sdl = std::make_unique<SdlAudioSink>();
+        if (sdl->open()) return sdl;
+        std::cerr << "[WARN] Audio unavailable, continuing without sound" << std::endl;
+    }
+    return std::make_unique<NullAudioSink>();
+}
+
+// 코어와 방언 결정: 강제 지정 > 헤더 > 내용 판별 (확신이 없으면 확장자 우선)
+static RomDetection resolve_rom(const std::string& extension, const RomImage& rom) {
+    RomDetection detection = detect_rom(rom.data(), rom.size());
+    if (!detection.from_header && !detection.confident) {
+        if (extension == ".ch8" || extension == ".c8") detection.kind = RomKind::Chip8;
+        else if (extension == ".ch32" || extension == ".c32") detection.kind = RomKind::Chip8_32;
+    }
+    if (g_rom_kind_forced) detection.kind = g_rom_kind;
+    if (g_dialect_forced) detection.dialect = g_dialect;
+    return detection;
+}
+
+// ROM 프로필 조회 (데이터베이스 기본 위치는 ROM과 같은 디렉토리의 romdb.txt)
+// 모르는 ROM은 기본값을 쓰고, --romdb-record면 판별 결과를 데이터베이스에 추가해 둔다
+static RomProfile find_profile(const std::string& rom_path, const RomImage& rom, const RomDetection& detection) {
+    std::string db_path = g_romdb_path;
+    if (db_path.empty()) {
+        const std::size_t slash = rom_path.find_last_of("/\\");
+        db_path = (slash == std::string::npos ? std::string() : rom_path.substr(0, slash + 1)) + RomDatabase::DEFAULT_FILE;
+    }
+
+    RomDatabase db;
+    const bool loaded = db.load(db_path);
+    const uint64_t hash = RomDatabase::hash(rom.data() + detection.offset, rom.size() - detection.offset);
+    if (const RomProfile* profile = db.find(hash)) {
+        std::cout << "[INFO] ROM profile: " << (profile->name.empty() ? "(unnamed)" : profile->name);
+        if (profile->ipf) std::cout << ", ipf " << profile->ipf;
+        if (profile->has_dialect) std::cout << ", " << dialect_name(profile->dialect);
+        if (profile->has_quirks) std::cout << ", quirks " << quirks_name(profile->quirks);
+        std::cout << std::endl;
+        return *profile;
+    }
+
+    RomProfile profile;
+    if (g_romdb_record) {
+        const std::size_t slash = rom_path.find_last_of("/\\");
+        profile.name = slash == std::string::npos ? rom_path : rom_path.substr(slash + 1);
+        if (detection.kind == RomKind::Chip8) {
+            profile.has_dialect = true;
+            profile.dialect = detection.dialect;
+        }
+        if (RomDatabase::append(db_path, hash, profile)) {
+            std::cout << "[INFO] Recorded unknown ROM in " << db_path << std::endl;
+        } else {
+            std::cerr << "[WARN] Cannot write ROM database: " << db_path << std::endl;
+        }
+        return RomProfile{};  // 기록만 하고 이번 실행은 기본값
+    }
+    LOG_INFO(General, "No ROM profile for %016llx in %s%s, using defaults", static_cast<unsigned long long>(hash),
+             db_path.c_str(), loaded ? "" : " (not found)");
+    return profile;
+}
+
+// 실행/디스어셈블 공통: ROM을 읽기 전용으로 열기
+static bool open_rom(const char* rom_path, RomImage& rom) {
+    if (RomError error = rom.open(rom_path); error != RomError::None) {
+        std::cerr << "[ERROR] Failed to open ROM: " << rom_path << " (" << rom_error_message(error) << ")" << std::endl;
+        return false;
+    }
+    return true;
+}
+
 int ModeSelector::select_and_run(const char* rom_path) {
-    std::string extension = get_file_extension(rom_path);
-    
-    if (extension == ".ch8" || extension == ".c8") {
-        std::cout << "[INFO] Detected 8-bit CHIP-8 ROM: " << rom_path << std::endl;
-        return run_8bit_mode(rom_path);
+    RomImage rom;
+    if (!open_rom(rom_path, rom)) return 1;
+
+    RomDetection detection = resolve_rom(get_file_extension(rom_path), rom);
+    std::cout << "[INFO] Detected " << rom_kind_name(detection.kind) << " ROM: " << rom_path;
+    if (detection.from_header) {
+        std::cout << " (header)";
+    } else {
+        std::cout << " (opcode match 8-bit " << static_cast<int>(detection.score_8 * 100)
+                  << "%, 32-bit " << static_cast<int>(detection.score_32 * 100) << "%"
+                  << (g_rom_kind_forced ? ", forced" : "") << ")";
     }
-    else if (extension == ".ch32" || extension == ".c32") {
-        std::cout << "[INFO] Detected 32-bit CHIP-8 ROM: " << rom_path << std::endl;
-        return run_32bit_mode(rom_path);
+    std::cout << std::endl;
+
+    // 프로필의 방언은 헤더나 --dialect가 없을 때만 적용
+    const RomProfile profile = find_profile(rom_path, rom, detection);
+    if (profile.has_dialect && !detection.from_header && !g_dialect_forced) detection.dialect = profile.dialect;
+
+    if (detection.kind == RomKind::Chip8) return run_8bit_mode(rom_path, rom, detection, profile);
+    return run_32bit_mode(rom_path, rom, detection, profile);
+}
+
+int ModeSelector::disassemble_rom(const char* rom_path) {
+    // 읽기 전용 매핑을 그대로 디스어셈블 (복사 없음)
+    RomImage rom;
+    if (!open_rom(rom_path, rom)) return 1;
+
+    const RomDetection detection = resolve_rom(get_file_extension(rom_path), rom);
+    const chip8emu::Isa isa = detection.kind == RomKind::Chip8 ? chip8emu::Isa::Chip8 : chip8emu::Isa::Chip8_32;
+    chip8emu::Disassembler::dump(isa, detection.dialect, rom.data() + detection.offset, rom.size() - detection.offset, 0x200, std::cout);
+    return 0;
+}
+
+// 코어별 준비 함수가 정하는 호스트 루프 설정 (루프 자체는 코어 종류를 모름)
+struct HostSetup {
+    const char* title = "CHIP-8 Emulator";
+    unsigned int ipf = DEFAULT_IPF_8;
+    unsigned int capture_width = VIDEO_WIDTH;     // 캡처 파일 크기 (코어의 최대 해상도)
+    unsigned int capture_height = VIDEO_HEIGHT;
+    std::function<unsigned int(unsigned int)> debug_step;  // 디버그 모드: 프레임마다 먼저 호출, 이번 프레임 명령어 수 (0 = 종료)
+};
+
+// 공통 호스트 루프: 1/60초 프레임마다 명령어 ipf개 실행 → 타이머 → 오디오 → 화면
+// 창/헤드리스/캡처는 Machine 인터페이스만 쓰므로 두 코어에 그대로 쓰인다.
+static int run_machine(Machine& machine, const HostSetup& setup) {
+    // 플랫폼 초기화 (창, 렌더링, 이벤트 처리는 렌더 스레드에서, 헤드리스면 SDL을 쓰지 않음)
+    std::unique_ptr<RenderThread> renderer;
+    if (!g_headless) {
+        renderer = std::make_unique<RenderThread>(setup.title, VIDEO_WIDTH * SCALE, VIDEO_HEIGHT * SCALE,
+                                                  VIDEO_WIDTH, VIDEO_HEIGHT, g_palette, g_keymap);
+        if (!renderer->start()) {
+            std::cerr << "[ERROR] Platform initialization failed!" << std::endl;
+            return 1;
+        }
+        renderer->set_turbo(g_turbo);
     }
-    else {
-        std::cerr << "[ERROR] Unsupported file extension '" << extension << "'" << std::endl;
-        std::cerr << "Supported extensions:" << std::endl;
-        std::cerr << "  .ch8, .c8   - 8-bit CHIP-8 mode" << std::endl;
-        std::cerr << "  .ch32, .c32 - 32-bit CHIP-8 extended mode" << std::endl;
+
+    // 오디오 (렌더 스레드보다 나중에 만들어 먼저 정리되도록)
+    std::unique_ptr<AudioSink> audio = create_audio_sink();
+    Beeper beeper(*audio);
+
+    // 화면 캡처 (프레임 경계마다 기록)
+    FrameCapture capture;
+    if (!g_capture_path.empty() && !open_capture(capture, setup.capture_width, setup.capture_height)) {
         return 1;
     }
+
+    const unsigned int ipf = instructions_per_frame(setup.ipf);
+    timer::FramePacer pacer(timer::NS_PER_SECOND / FRAME_RATE);
+    InputScheduler input;
+    bool turbo = false;
+    bool was_turbo = false;
+    uint64_t frame_count = 0;
+    bool quit = false;
+
+    while (!quit) {
+        // 입력 처리 (프레임당 한 번 모아서, 명령어 위치별로 반영)
+        if (renderer) {
+            quit = renderer->poll_input(input, ipf);
+            was_turbo = turbo;
+            turbo = renderer->turbo();
+        }
+
+        // 디버그 정보 출력 (실행 전, 단계 실행 중이면 명령어 하나만 실행)
+        // 연속 실행 중의 브레이크포인트/트레이스포인트는 run_batch 안에서 명령어마다 검사된다.
+        const unsigned int count = setup.debug_step ? setup.debug_step(ipf) : ipf;
+        if (count == 0) break;
+
+        machine.run_batch(count, input);
+        if (machine.is_halted()) {
+            std::cout << "[INFO] ROM halted (" << machine.name() << ")" << std::endl;
+            break;
+        }
+
+        // 타이머 업데이트 (60Hz)
+        machine.tick_timers();
+
+        // 사운드 타이머가 0보다 크면 비프음 (오디오 패턴이 있으면 패턴 재생)
+        const MachineSound sound = machine.sound();
+        if (sound.pattern) beeper.set_pattern(sound.pattern, sound.pitch);
+        beeper.pump(sound.active);
+
+        // 화면 업데이트 (터보 모드에서 표시가 밀려 있으면 이번 프레임은 복사하지 않고 건너뜀)
+        if (!renderer) {
+            machine.clear_draw_flag();
+        } else if (machine.needs_redraw() && !(turbo && renderer->presenter_behind())) {
+            renderer->submit(machine.frame());
+            machine.clear_draw_flag();
+        }
+        if (capture.is_open()) capture.submit(machine.frame());
+
+        ++frame_count;
+        if (g_max_frames && frame_count >= g_max_frames) break;
+
+        // 터보 모드와 헤드리스 실행은 페이싱 없이 바로 다음 프레임으로
+        if (!renderer) continue;
+        renderer->count_emulated_frame();
+        if (turbo) continue;
+        if (was_turbo) pacer.restart();
+        pacer.wait();
+    }
+
+    print_pacing_stats(pacer);
+    print_capture_stats(capture);
+    std::cout << "[INFO] Executed " << machine.stats().instructions << " instructions in "
+              << machine.stats().batches << " frames" << std::endl;
+    std::cout << "[INFO] " << machine.name() << " emulator terminated" << std::endl;
+    return 0;
+}
+
+// 디버그 모드면 디버거를 켜고, 호스트 루프가 프레임마다 부를 함수를 만든다
+template <typename Core, typename Debugger>
+static std::function<unsigned int(unsigned int)> attach_debugger(Core& core, Debugger& debugger, const char* mode_name) {
+    if (!g_debug_mode) return {};
+    debugger.enable(true);
+    debugger.setStepMode(true);
+    std::cout << "🐛 Debug mode enabled for " << mode_name << "\n";
+    return [&core, &debugger](unsigned int ipf) -> unsigned int {
+        if (!debugger.isEnabled()) return 0;  // 디버거에서 quit 명령을 받으면 종료
+        debugger.printState(core.getCurrentOpcode());
+        if (!debugger.isEnabled()) return 0;
+        return debugger.isStepMode() ? 1 : ipf;
+    };
+}
+
+// 공통: 프로그램 로드 (실패 시 오류 출력)
+static bool load_program(Machine& machine, const char* rom_path, const RomImage& rom, const RomDetection& detection) {
+    if (RomError error = machine.load(rom.data() + detection.offset, rom.size() - detection.offset);
+        error != RomError::None) {
+        std::cerr << "[ERROR] Failed to load ROM: " << rom_path << " (" << rom_error_message(error) << ")" << std::endl;
+        return false;
+    }
+    return true;
 }
 
-int ModeSelector::run_8bit_mode(const char* rom_path) {
+static void print_controls() {
+    std::cout << "  Controls: 1234/QWER/ASDF/ZXCV, Tab = turbo" << std::endl;
+    if (g_debug_mode) {
+        std::cout << "  🐛 Debug Mode: ON (Type 'help' for commands)" << std::endl;
+    }
+}
+
+int ModeSelector::run_8bit_mode(const char* rom_path, const RomImage& rom, const RomDetection& detection,
+                                const RomProfile& profile) {
     std::cout << "\n=== Starting 8-bit CHIP-8 Emulator ===" << std::endl;
-    
+
     // 8비트 전용 초기화
     OpcodeTable::Initialize();
-    Chip8 chip8;
-    
-    // 디버거 생성
+    CoreMachine<Chip8> machine("8-bit CHIP-8");
+    Chip8& chip8 = machine.core();
+    chip8.set_dialect(detection.dialect);
+    chip8.set_quirks(g_quirks_forced ? g_quirks : profile.quirks);
+    if (!load_program(machine, rom_path, rom, detection)) return 1;
+
+    HostSetup setup;
+    setup.title = "CHIP-8 Emulator (8-bit Mode)";
+    setup.ipf = profile.ipf ? profile.ipf : DEFAULT_IPF_8;
+    setup.capture_width = chip8.get_dialect() == Dialect::Chip8 ? VIDEO_WIDTH : VIDEO_WIDTH_HI;
+    setup.capture_height = chip8.get_dialect() == Dialect::Chip8 ? VIDEO_HEIGHT : VIDEO_HEIGHT_HI;
+
+    // 디버거 (호스트 루프가 끝날 때까지 유지)
     chip8emu::Debugger8 debugger(chip8);
-    if (g_debug_mode) {
-        debugger.enable(true);
-        debugger.setStepMode(true);
-        std::cout << "🐛 Debug mode enabled for 8-bit CHIP-8\n";
-    }
-    
-    // 플랫폼 초기화
-    Platform platform("CHIP-8 Emulator (8-bit Mode)", 
-                      VIDEO_WIDTH * SCALE, VIDEO_HEIGHT * SCALE,
-                      VIDEO_WIDTH, VIDEO_HEIGHT);
-    
-    if (!platform.Initialize()) {
-        std::cerr << "[ERROR] Platform initialization failed!" << std::endl;
-        return 1;
-    }
-    
-    // ROM 로드
-    if (!chip8.load_rom(rom_path)) {
-        std::cerr << "[ERROR] Failed to load ROM: " << rom_path << std::endl;
-        return 1;
-    }
-    
+    setup.debug_step = attach_debugger(chip8, debugger, "8-bit CHIP-8");
+
     // 시스템 정보 출력
     std::cout << "[INFO] 8-bit CHIP-8 System Ready" << std::endl;
-    std::cout << "  Memory: 4KB (4096 bytes)" << std::endl;
+    std::cout << "  Dialect: " << dialect_name(chip8.get_dialect()) << std::endl;
+    std::cout << "  Memory: " << chip8.memory_size() / 1024 << "KB (" << chip8.memory_size() << " bytes)" << std::endl;
     std::cout << "  Registers: 16 x 8-bit (V0-VF)" << std::endl;
     std::cout << "  Stack: 16 levels" << std::endl;
     std::cout << "  Instruction Size: 2 bytes" << std::endl;
-    std::cout << "  Controls: 1234/QWER/ASDF/ZXCV" << std::endl;
-    
-    if (g_debug_mode) {
-        std::cout << "  🐛 Debug Mode: ON (Type 'help' for commands)" << std::endl;
-    }
-    
-    // 메인 루프 - 수정된 부분
-    bool quit = false;
-    bool debugger_active = true;  // 디버거 상태를 별도로 관리
-    
-    while (!quit && debugger_active) {
-        // 입력 처리
-        quit = platform.ProcessInput(chip8.keypad);
-        
-        // 디버그 정보 출력 (실행 전) - 디버그 모드일 때만
-        if (debugger.isEnabled()) {
-            uint32_t current_opcode = chip8.getCurrentOpcode();
-            debugger.printState(current_opcode);
-            
-            // 디버거에서 quit 명령을 받았는지 확인
-            if (!debugger.isEnabled()) {
-                debugger_active = false;
-                break;
-            }
-        }
-        
-        // CPU 사이클 실행
-        chip8.cycle();
-        
-        // 타이머 업데이트 (60Hz)
-        if (chip8.delay_timer > 0) chip8.delay_timer--;
-        if (chip8.sound_timer > 0) chip8.sound_timer--;
-        
-        // 화면 업데이트
-        if (chip8.needs_redraw()) {
-            platform.Update(chip8.video, VIDEO_WIDTH * sizeof(uint32_t));
-            chip8.clear_draw_flag();
-        }
-        
-        timer::delay(g_debug_mode ? 100 : 16); // 디버그 모드에서는 느리게
-    }
-    
-    std::cout << "[INFO] 8-bit CHIP-8 emulator terminated" << std::endl;
-    return 0;
+    print_controls();
+
+    return run_machine(machine, setup);
 }
 
-int ModeSelector::run_32bit_mode(const char* rom_path) {
+int ModeSelector::run_32bit_mode(const char* rom_path, const RomImage& rom, const RomDetection& detection,
+                                 const RomProfile& profile) {
     std::cout << "\n=== Starting 32-bit CHIP-8 Extended Emulator ===" << std::endl;
-    
+
     // 32비트 전용 초기화
     OpcodeTable_32::Initialize();
-    Chip8_32 chip8_32;
-    
-    // 디버거 생성
+    CoreMachine<Chip8_32> machine("32-bit CHIP-8");
+    Chip8_32& chip8_32 = machine.core();
+    if (!load_program(machine, rom_path, rom, detection)) return 1;
+
+    HostSetup setup;
+    setup.title = "CHIP-8 Emulator (32-bit Extended Mode)";
+    setup.ipf = profile.ipf ? profile.ipf : DEFAULT_IPF_32;
+    setup.capture_width = VIDEO_WIDTH_MAX;
+    setup.capture_height = VIDEO_HEIGHT_MAX;
+
+    // 디버거 (호스트 루프가 끝날 때까지 유지)
     chip8emu::Debugger32 debugger(chip8_32);
-    if (g_debug_mode) {
-        debugger.enable(true);
-        debugger.setStepMode(true);
-        std::cout << "🐛 Debug mode enabled for 32-bit CHIP-8\n";
-    }
-    
-    // 플랫폼 초기화
-    Platform platform("CHIP-8 Emulator (32-bit Extended Mode)", 
-                      VIDEO_WIDTH * SCALE, VIDEO_HEIGHT * SCALE,
-                      VIDEO_WIDTH, VIDEO_HEIGHT);
-    
-    if (!platform.Initialize()) {
-        std::cerr << "[ERROR] Platform initialization failed!" << std::endl;
-        return 1;
-    }
-    
-    // ROM 로드
-    if (!chip8_32.load_rom(rom_path)) {
-        std::cerr << "[ERROR] Failed to load ROM: " << rom_path << std::endl;
-        return 1;
-    }
-    
+    setup.debug_step = attach_debugger(chip8_32, debugger, "32-bit CHIP-8");
+
     // 시스템 정보 출력
     std::cout << "[INFO] 32-bit CHIP-8 Extended System Ready" << std::endl;
     std::cout << "  Memory: 64KB (65536 bytes)" << std::endl;
     std::cout << "  Registers: 32 x 32-bit (R0-R31)" << std::endl;
     std::cout << "  Stack: 32 levels" << std::endl;
     std::cout << "  Instruction Size: 4 bytes" << std::endl;
-    std::cout << "  Controls: 1234/QWER/ASDF/ZXCV" << std::endl;
-    
-    if (g_debug_mode) {
-        std::cout << "  🐛 Debug Mode: ON (Type 'help' for commands)" << std::endl;
-    }
-    
-    // 메인 루프 - 수정된 부분
-    bool quit = false;
-    bool debugger_active = true;  // 디버거 상태를 별도로 관리
-    
-    while (!quit && debugger_active) {
-        // 입력 처리
-        quit = platform.ProcessInput(chip8_32.keypad);
-        
-        // 디버그 정보 출력 (실행 전) - 디버그 모드일 때만
-        if (debugger.isEnabled()) {
-            uint32_t current_opcode = chip8_32.getCurrentOpcode();
-            debugger.printState(current_opcode);
-            
-            // 디버거에서 quit 명령을 받았는지 확인
-            if (!debugger.isEnabled()) {
-                debugger_active = false;
-                break;
-            }
-        }
-        
-        // CPU 사이클 실행
-        chip8_32.cycle();
-        
-        // 화면 업데이트
-        if (chip8_32.needs_redraw()) {
-            platform.Update(chip8_32.video, VIDEO_WIDTH * sizeof(uint32_t));
-            chip8_32.clear_draw_flag();
-        }
-        
-        timer::delay(g_debug_mode ? 50 : 2); // 디버그 모드에서는 느리게
-    }
-    
-    std::cout << "[INFO] 32-bit CHIP-8 extended emulator terminated" << std::endl;
-    return 0;
+    print_controls();
+
+    return run_machine(machine, setup);
 }
 
 std::string ModeSelector::get_file_extension(const std::string& filename) {
@@ -1,27 +1,54 @@
 #include "opcode_table.hpp"
 #include "chip8.hpp"
+#include "common/log.hpp"
 
 #include <stdexcept>
-#include <iostream>
+#include <utility>
 #include <cstring> // memset, memcpy
-#include <random>  // for CXNN
-#include <fstream>
 #include <vector>
 
 namespace OpcodeTable {
 
-    // 16개의 주요 명령 그룹(상위 4비트로 구분)을 처리하기 위한 함수 테이블
-    std::array<OpcodeTable::OpcodeHandler, 16> primary_table;
+    // 방언 x quirk 조합별로 16개의 주요 명령 그룹(상위 4비트로 구분)을 처리하기 위한 함수 테이블
+    std::array<std::array<DispatchTable, NUM_QUIRK_SETS>, NUM_DIALECTS> dialect_tables;
 
-    /// @brief 화면을 지우는 명령 (00E0)
+    void OP_UNKNOWN(Chip8& chip8, uint16_t opcode) {
+        LOG_WARN(Cpu8, "Unknown opcode: 0x%04X at PC=0x%X", opcode, chip8.get_pc());
+        chip8.set_pc(chip8.get_pc() + 2);
+    }
+
+    /// @brief 조건 분기에서 건너뛸 크기
+    /// XO-CHIP은 다음 명령어가 4바이트 F000 NNNN이면 통째로 건너뛴다. 다른 방언은 항상 2바이트.
+    template <Dialect D>
+    uint16_t skip_size(const Chip8& chip8) {
+        if constexpr (D == Dialect::XoChip) {
+            uint16_t next = chip8.get_pc() + 2;
+            if (chip8.peek_memory(next) == 0xF0 && chip8.peek_memory(next + 1) == 0x00) return 6;
+        }
+        return 4;
+    }
+
+    /// @brief 화면을 지우는 명령 (00E0), XO-CHIP은 선택된 평면만 지움
+    template <Dialect D>
     void OP_00E0(Chip8& chip8, uint16_t) {
-        chip8.get_video().fill(0);
+        if constexpr (D == Dialect::XoChip) {
+            const uint8_t keep = static_cast<uint8_t>(~chip8.get_planes());
+            for (uint8_t& pixel : chip8.get_video()) pixel &= keep;
+        } else {
+            chip8.get_video().fill(0);
+        }
         chip8.set_draw_flag(true);
         chip8.set_pc(chip8.get_pc() + 2);
     }
 
     /// @brief 서브루틴 반환 명령 (00EE)
     void OP_00EE(Chip8& chip8, uint16_t) {
+        if (chip8.get_sp() == 0) {
+            LOG_WARN(Cpu8, "Stack underflow at PC=0x%X", chip8.get_pc());
+            chip8.set_pc(chip8.get_pc() + 2);
+            return;
+        }
+
         chip8.set_sp(chip8.get_sp() - 1);
         chip8.set_pc(chip8.stack_at(chip8.get_sp()) + 2);
     }
@@ -33,30 +60,59 @@ namespace OpcodeTable {
 
     /// @brief 서브루틴 호출 (2NNN)
     void OP_2NNN(Chip8& chip8, uint16_t opcode) {
+        if (chip8.get_sp() >= STACK_SIZE) {
+            LOG_WARN(Cpu8, "Stack overflow at PC=0x%X", chip8.get_pc());
+            chip8.set_pc(chip8.get_pc() + 2);
+            return;
+        }
+
         chip8.stack_at(chip8.get_sp()) = chip8.get_pc();
         chip8.set_sp(chip8.get_sp() + 1);
         chip8.set_pc(opcode & 0x0FFF);
     }
 
     /// @brief Vx가 NN과 같으면 다음 명령어 건너뜀 (3XNN)
+    template <Dialect D>
     void OP_3XNN(Chip8& chip8, uint16_t opcode) {
         uint8_t x = (opcode & 0x0F00) >> 8;
         uint8_t nn = opcode & 0x00FF;
-        chip8.set_pc(chip8.get_pc() + (chip8.get_V(x) == nn ? 4 : 2));
+        chip8.set_pc(chip8.get_pc() + (chip8.get_V(x) == nn ? skip_size<D>(chip8) : 2));
     }
 
     /// @brief Vx가 NN과 다르면 다음 명령어 건너뜀 (4XNN)
+    template <Dialect D>
     void OP_4XNN(Chip8& chip8, uint16_t opcode) {
         uint8_t x = (opcode & 0x0F00) >> 8;
         uint8_t nn = opcode & 0x00FF;
-        chip8.set_pc(chip8.get_pc() + (chip8.get_V(x) != nn ? 4 : 2));
+        chip8.set_pc(chip8.get_pc() + (chip8.get_V(x) != nn ? skip_size<D>(chip8) : 2));
     }
 
     /// @brief Vx == Vy면 다음 명령어 건너뜀 (5XY0)
-    void OP_5XY0(Chip8& chip8, uint16_t opcode) {
+    /// XO-CHIP: 5XY2 = Vx..Vy를 I부터 저장, 5XY3 = I부터 Vx..Vy로 읽기 (I는 그대로, x > y면 역순)
+    template <Dialect D>
+    void OP_5XYN(Chip8& chip8, uint16_t opcode) {
         uint8_t x = (opcode & 0x0F00) >> 8;
         uint8_t y = (opcode & 0x00F0) >> 4;
-        chip8.set_pc(chip8.get_pc() + ((opcode & 0x000F) == 0 && chip8.get_V(x) == chip8.get_V(y) ? 4 : 2));
+        uint8_t n = opcode & 0x000F;
+
+        if constexpr (D == Dialect::XoChip) {
+            if (n == 0x2 || n == 0x3) {
+                int step = x <= y ? 1 : -1;
+                int count = (x <= y ? y - x : x - y) + 1;
+                for (int i = 0; i < count; ++i) {
+                    int reg = x + i * step;
+                    if (n == 0x2) chip8.set_memory(chip8.get_I() + i, chip8.get_V(reg));
+                    else          chip8.set_V(reg, chip8.get_memory(chip8.get_I() + i));
+                }
+                chip8.set_pc(chip8.get_pc() + 2);
+                return;
+            }
+        }
+        if (n != 0) {
+            OP_UNKNOWN(chip8, opcode);
+            return;
+        }
+        chip8.set_pc(chip8.get_pc() + (chip8.get_V(x) == chip8.get_V(y) ? skip_size<D>(chip8) : 2));
     }
 
     /// @brief Vx에 NN 저장 (6XNN)
@@ -74,6 +130,8 @@ namespace OpcodeTable {
     }
 
     /// @brief Vx와 Vy 간 다양한 연산 수행 (8XYN)
+    /// quirks: shift = 시프트 원본이 Vy, vfreset = 논리 연산 후 VF = 0
+    template <typename Q>
     void OP_8XYN(Chip8& chip8, uint16_t opcode) {
         uint8_t x = (opcode & 0x0F00) >> 8;
         uint8_t y = (opcode & 0x00F0) >> 4;
@@ -83,9 +141,9 @@ namespace OpcodeTable {
 
         switch (n) {
             case 0x0: chip8.set_V(x, vy); break;
-            case 0x1: chip8.set_V(x, vx | vy); break;
-            case 0x2: chip8.set_V(x, vx & vy); break;
-            case 0x3: chip8.set_V(x, vx ^ vy); break;
+            case 0x1: chip8.set_V(x, vx | vy); if constexpr (Q::vf_reset) chip8.set_V(0xF, 0); break;
+            case 0x2: chip8.set_V(x, vx & vy); if constexpr (Q::vf_reset) chip8.set_V(0xF, 0); break;
+            case 0x3: chip8.set_V(x, vx ^ vy); if constexpr (Q::vf_reset) chip8.set_V(0xF, 0); break;
             case 0x4: {
                 uint16_t sum = vx + vy;
                 chip8.set_V(0xF, sum > 0xFF);  // carry flag
@@ -96,27 +154,39 @@ namespace OpcodeTable {
                 chip8.set_V(0xF, vx > vy);  // borrow flag
                 chip8.set_V(x, vx - vy);
                 break;
-            case 0x6:
-                chip8.set_V(0xF, vx & 0x1);  // LSB 저장
-                chip8.set_V(x, vx >> 1);
+            case 0x6: {
+                uint8_t source = Q::shift_vy ? vy : vx;
+                chip8.set_V(0xF, source & 0x1);  // LSB 저장
+                chip8.set_V(x, source >> 1);
                 break;
+            }
             case 0x7:
                 chip8.set_V(0xF, vy > vx);  // borrow flag
                 chip8.set_V(x, vy - vx);
                 break;
-            case 0xE:
-                chip8.set_V(0xF, (vx & 0x80) >> 7);  // MSB 저장
-                chip8.set_V(x, vx << 1);
+            case 0xE: {
+                uint8_t source = Q::shift_vy ? vy : vx;
+                chip8.set_V(0xF, (source & 0x80) >> 7);  // MSB 저장
+                chip8.set_V(x, source << 1);
                 break;
+            }
+            default:
+                OP_UNKNOWN(chip8, opcode);
+                return;
         }
         chip8.set_pc(chip8.get_pc() + 2);
     }
 
     /// @brief Vx != Vy면 다음 명령어 건너뜀 (9XY0)
+    template <Dialect D>
     void OP_9XY0(Chip8& chip8, uint16_t opcode) {
         uint8_t x = (opcode & 0x0F00) >> 8;
         uint8_t y = (opcode & 0x00F0) >> 4;
-        chip8.set_pc(chip8.get_pc() + ((opcode & 0x000F) == 0 && chip8.get_V(x) != chip8.get_V(y) ? 4 : 2));
+        if ((opcode & 0x000F) != 0) {
+            OP_UNKNOWN(chip8, opcode);
+            return;
+        }
+        chip8.set_pc(chip8.get_pc() + (chip8.get_V(x) != chip8.get_V(y) ? skip_size<D>(chip8) : 2));
     }
 
     /// @brief I에 NNN 저장 (ANNN)
@@ -125,55 +195,112 @@ namespace OpcodeTable {
         chip8.set_pc(chip8.get_pc() + 2);
     }
 
-    /// @brief PC = NNN + V0 (BNNN)
+    /// @brief PC = NNN + V0 (BNNN), jump quirk이면 PC = XNN + Vx (BXNN)
+    template <typename Q>
     void OP_BNNN(Chip8& chip8, uint16_t opcode) {
-        chip8.set_pc((opcode & 0x0FFF) + chip8.get_V(0));
+        uint8_t reg = Q::jump_vx ? (opcode & 0x0F00) >> 8 : 0;
+        chip8.set_pc((opcode & 0x0FFF) + chip8.get_V(reg));
     }
 
-    /// @brief Vx에 rand() & NN 저장 (CXNN)
+    /// @brief Vx에 난수 & NN 저장 (CXNN, 코어별 시드 난수)
     void OP_CXNN(Chip8& chip8, uint16_t opcode) {
         uint8_t x = (opcode & 0x0F00) >> 8;
-        chip8.set_V(x, (rand() % 256) & (opcode & 0x00FF));
+        chip8.set_V(x, chip8.random_byte() & (opcode & 0x00FF));
         chip8.set_pc(chip8.get_pc() + 2);
     }
 
     /// @brief 스프라이트 그리기 (DXYN)
+    /// SUPER-CHIP/XO-CHIP: N = 0이면 16x16 스프라이트 (행당 2바이트, 32바이트)
+    /// XO-CHIP: 선택된 평면마다 차례로 그리며, 평면 2의 데이터는 평면 1 데이터 바로 뒤에 온다
+    template <Dialect D, typename Q>
     void OP_DXYN(Chip8& chip8, uint16_t opcode) {
         uint8_t x = chip8.get_V((opcode & 0x0F00) >> 8);
         uint8_t y = chip8.get_V((opcode & 0x00F0) >> 4);
         uint8_t height = opcode & 0x000F;
-        chip8.set_V(0xF, 0);  // 충돌 감지 플래그
-
-        for (int row = 0; row < height; ++row) {
-            uint8_t sprite = chip8.get_memory(chip8.get_I() + row);
-            for (int col = 0; col < 8; ++col) {
-                if (sprite & (0x80 >> col)) {
-                    uint32_t index = ((y + row) % VIDEO_HEIGHT) * VIDEO_WIDTH + ((x + col) % VIDEO_WIDTH);
-                    if (chip8.get_video(index)) chip8.set_V(0xF, 1);
-                    chip8.set_video(index, chip8.get_video(index) ^ 1);
-                }
+
+        unsigned int sprite_width = 8;
+        if constexpr (D != Dialect::Chip8) {
+            if (height == 0) {
+                height = 16;
+                sprite_width = 16;
             }
         }
+        const unsigned int bytes = height * (sprite_width / 8);
+
+        uint8_t planes = 1;
+        if constexpr (D == Dialect::XoChip) planes = chip8.get_planes();
+
+        bool collision = false;
+        uint16_t address = chip8.get_I();
+        uint8_t rows[32];
+        for (uint8_t plane = 1; plane <= 2; plane <<= 1) {
+            if (!(planes & plane)) continue;
+            for (unsigned int i = 0; i < bytes; ++i) rows[i] = chip8.get_memory(address + i);
+            address += bytes;
+            collision |= frame::xor_sprite(chip8.get_video().data(), chip8.video_width(), chip8.video_height(),
+                                           x, y, rows, height, sprite_width, plane, Q::clip);
+        }
+
+        chip8.set_V(0xF, collision ? 1 : 0);  // 충돌 감지 플래그
         chip8.set_draw_flag(true);
         chip8.set_pc(chip8.get_pc() + 2);
     }
 
     /// @brief 키 입력 조건 분기 (EX9E, EXA1)
+    template <Dialect D>
     void OP_EX(Chip8& chip8, uint16_t opcode) {
         uint8_t x = (opcode & 0x0F00) >> 8;
         uint8_t key = chip8.get_V(x);
         if ((opcode & 0x00FF) == 0x9E)
-            chip8.set_pc(chip8.get_pc() + (chip8.get_key(key) ? 4 : 2));
+            chip8.set_pc(chip8.get_pc() + (chip8.get_key(key) ? skip_size<D>(chip8) : 2));
         else if ((opcode & 0x00FF) == 0xA1)
-            chip8.set_pc(chip8.get_pc() + (!chip8.get_key(key) ? 4 : 2));
+            chip8.set_pc(chip8.get_pc() + (!chip8.get_key(key) ? skip_size<D>(chip8) : 2));
         else
-            chip8.set_pc(chip8.get_pc() + 2);
+            OP_UNKNOWN(chip8, opcode);
     }
 
-    /// @brief Fx 계열 확장 명령들 처리
+    /// @brief Fx 계열 확장 명령들 처리 (memory quirk: FX55 / FX65 후 I 증가)
+    template <Dialect D, typename Q>
     void OP_FX(Chip8& chip8, uint16_t opcode) {
         uint8_t x = (opcode & 0x0F00) >> 8;
         uint8_t nn = opcode & 0x00FF;
+
+        if constexpr (D == Dialect::XoChip) {
+            switch (opcode) {
+                case 0xF000: {  // F000 NNNN: I = 다음 2바이트 (4바이트 명령어)
+                    uint16_t pc = chip8.get_pc();
+                    chip8.set_I(static_cast<uint16_t>((chip8.get_memory(pc + 2) << 8) | chip8.get_memory(pc + 3)));
+                    chip8.set_pc(pc + 4);
+                    return;
+                }
+                case 0xF002:    // 오디오 패턴 버퍼 = I부터 16바이트
+                    for (unsigned int i = 0; i < AUDIO_PATTERN_SIZE; ++i)
+                        chip8.set_audio_pattern(i, chip8.get_memory(chip8.get_I() + i));
+                    chip8.set_pc(chip8.get_pc() + 2);
+                    return;
+            }
+            switch (nn) {
+                case 0x01: chip8.set_planes(x); chip8.set_pc(chip8.get_pc() + 2); return;          // FN01: 평면 선택
+                case 0x3A: chip8.set_audio_pitch(chip8.get_V(x)); chip8.set_pc(chip8.get_pc() + 2); return;  // 피치
+            }
+        }
+        if constexpr (D != Dialect::Chip8) {
+            switch (nn) {
+                case 0x30:  // 큰 폰트 주소 (SUPER-CHIP은 숫자 0~9, XO-CHIP은 0~F)
+                    chip8.set_I(BIG_FONT_ADDRESS + (chip8.get_V(x) & 0xF) * 10);
+                    chip8.set_pc(chip8.get_pc() + 2);
+                    return;
+                case 0x75:  // RPL 플래그에 V0..Vx 저장
+                    for (int i = 0; i <= x; ++i) chip8.set_rpl(i, chip8.get_V(i));
+                    chip8.set_pc(chip8.get_pc() + 2);
+                    return;
+                case 0x85:  // RPL 플래그에서 V0..Vx 읽기
+                    for (int i = 0; i <= x; ++i) chip8.set_V(i, chip8.get_rpl(i));
+                    chip8.set_pc(chip8.get_pc() + 2);
+                    return;
+            }
+        }
+
         switch (nn) {
             case 0x07: chip8.set_V(x, chip8.get_delay_timer()); break;
             case 0x0A: {
@@ -189,7 +316,7 @@ namespace OpcodeTable {
             case 0x15: chip8.set_delay_timer(chip8.get_V(x)); break;
             case 0x18: chip8.set_sound_timer(chip8.get_V(x)); break;
             case 0x1E: chip8.set_I(chip8.get_I() + chip8.get_V(x)); break;
-            case 0x29: chip8.set_I(chip8.get_V(x) * 5); break;  // 폰트 주소
+            case 0x29: chip8.set_I(FONT_ADDRESS + chip8.get_V(x) * 5); break;  // 폰트 주소
             case 0x33: {  // BCD 변환
                 uint8_t vx = chip8.get_V(x);
                 chip8.set_memory(chip8.get_I(), vx / 100);
@@ -200,58 +327,165 @@ namespace OpcodeTable {
             case 0x55:
                 for (int i = 0; i <= x; ++i)
                     chip8.set_memory(chip8.get_I() + i, chip8.get_V(i));
+                if constexpr (Q::memory_i) chip8.set_I(chip8.get_I() + x + 1);
                 break;
             case 0x65:
                 for (int i = 0; i <= x; ++i)
                     chip8.set_V(i, chip8.get_memory(chip8.get_I() + i));
+                if constexpr (Q::memory_i) chip8.set_I(chip8.get_I() + x + 1);
                 break;
+            default:
+                OP_UNKNOWN(chip8, opcode);
+                return;
         }
         chip8.set_pc(chip8.get_pc() + 2);
     }
 
-    /// @brief opcode 상위 4비트 기반으로 핸들러 함수 등록
-    void Initialize() {
-        primary_table.fill(nullptr);
-
-        primary_table[0x0] = [](Chip8& chip8, uint16_t opcode) {
-            switch (opcode & 0x00FF) {
-                case 0xE0: OP_00E0(chip8, opcode); break;
-                case 0xEE: OP_00EE(chip8, opcode); break;
-                default:
-                    std::cerr << "Unknown 0x0 opcode: " << std::hex << opcode << "\n";
-                    chip8.set_pc(chip8.get_pc() + 2);
-                    break;
+    /// @brief 0NNN 그룹 (00E0, 00EE + SUPER-CHIP/XO-CHIP 스크롤, 해상도, 종료)
+    /// 나머지는 기계어 루틴 호출(SYS)로, 실행할 수 없으므로 건너뛴다.
+    template <Dialect D>
+    void OP_0NNN(Chip8& chip8, uint16_t opcode) {
+        if constexpr (D != Dialect::Chip8) {
+            if ((opcode & 0xFFF0) == 0x00C0 ||
+                (D == Dialect::XoChip && (opcode & 0xFFF0) == 0x00D0)) {
+                int n = opcode & 0x000F;                             // 00CN: 아래로 N줄, 00DN: 위로 N줄
+                chip8.scroll(0, (opcode & 0x00F0) == 0x00C0 ? n : -n);
+                chip8.set_draw_flag(true);
+                chip8.set_pc(chip8.get_pc() + 2);
+                return;
             }
-        };
+            switch (opcode) {
+                case 0x00FB: chip8.scroll(4, 0); chip8.set_draw_flag(true); chip8.set_pc(chip8.get_pc() + 2); return;
+                case 0x00FC: chip8.scroll(-4, 0); chip8.set_draw_flag(true); chip8.set_pc(chip8.get_pc() + 2); return;
+                case 0x00FD: chip8.halt(); return;                   // 인터프리터 종료
+                case 0x00FE: chip8.set_hires(false); chip8.set_pc(chip8.get_pc() + 2); return;
+                case 0x00FF: chip8.set_hires(true); chip8.set_pc(chip8.get_pc() + 2); return;
+            }
+        }
 
-        primary_table[0x1] = OP_1NNN;
-        primary_table[0x2] = OP_2NNN;
-        primary_table[0x3] = OP_3XNN;
-        primary_table[0x4] = OP_4XNN;
-        primary_table[0x5] = OP_5XY0;
-        primary_table[0x6] = OP_6XNN;
-        primary_table[0x7] = OP_7XNN;
-        primary_table[0x8] = OP_8XYN;
-        primary_table[0x9] = OP_9XY0;
-        primary_table[0xA] = OP_ANNN;
-        primary_table[0xB] = OP_BNNN;
-        primary_table[0xC] = OP_CXNN;
-        primary_table[0xD] = OP_DXYN;
-        primary_table[0xE] = OP_EX;
-        primary_table[0xF] = OP_FX;
+        switch (opcode) {
+            case 0x00E0: OP_00E0<D>(chip8, opcode); break;
+            case 0x00EE: OP_00EE(chip8, opcode); break;
+            default:
+                LOG_WARN(Cpu8, "Ignoring SYS 0x%03X at PC=0x%X", opcode, chip8.get_pc());
+                chip8.set_pc(chip8.get_pc() + 2);
+                break;
+        }
     }
 
-    /// @brief opcode를 상위 4비트로 분기하여 실행
-    void Execute(Chip8& chip8, uint16_t opcode) {
-        uint8_t index = (opcode & 0xF000) >> 12;
-        OpcodeTable::OpcodeHandler handler = primary_table[index];
+    /// @brief 위 핸들러들이 처리하는 명령어 정의 (mask, pattern, 니모닉, 피연산자 서식)
+    const std::vector<OpcodeInfo>& Definitions() {
+        static const std::vector<OpcodeInfo> defs = {
+            {0xFFFF, 0x00E0, "CLS",  ""},
+            {0xFFFF, 0x00EE, "RET",  ""},
+            {0xFFF0, 0x00C0, "SCD",  "%n", Dialect::SuperChip},
+            {0xFFF0, 0x00D0, "SCU",  "%n", Dialect::XoChip},
+            {0xFFFF, 0x00FB, "SCR",  "", Dialect::SuperChip},
+            {0xFFFF, 0x00FC, "SCL",  "", Dialect::SuperChip},
+            {0xFFFF, 0x00FD, "EXIT", "", Dialect::SuperChip},
+            {0xFFFF, 0x00FE, "LOW",  "", Dialect::SuperChip},
+            {0xFFFF, 0x00FF, "HIGH", "", Dialect::SuperChip},
+            {0xF000, 0x0000, "SYS",  "%a"},
+            {0xF000, 0x1000, "JP",   "%a"},
+            {0xF000, 0x2000, "CALL", "%a"},
+            {0xF000, 0x3000, "SE",   "%x, %k"},
+            {0xF000, 0x4000, "SNE",  "%x, %k"},
+            {0xF00F, 0x5000, "SE",   "%x, %y"},
+            {0xF00F, 0x5002, "SAVE", "%x - %y", Dialect::XoChip},
+            {0xF00F, 0x5003, "LOAD", "%x - %y", Dialect::XoChip},
+            {0xF000, 0x6000, "LD",   "%x, %k"},
+            {0xF000, 0x7000, "ADD",  "%x, %k"},
+            {0xF00F, 0x8000, "LD",   "%x, %y"},
+            {0xF00F, 0x8001, "OR",   "%x, %y"},
+            {0xF00F, 0x8002, "AND",  "%x, %y"},
+            {0xF00F, 0x8003, "XOR",  "%x, %y"},
+            {0xF00F, 0x8004, "ADD",  "%x, %y"},
+            {0xF00F, 0x8005, "SUB",  "%x, %y"},
+            {0xF00F, 0x8006, "SHR",  "%x"},
+            {0xF00F, 0x8007, "SUBN", "%x, %y"},
+            {0xF00F, 0x800E, "SHL",  "%x"},
+            {0xF00F, 0x9000, "SNE",  "%x, %y"},
+            {0xF000, 0xA000, "LD",   "I, %a"},
+            {0xF000, 0xB000, "JP",   "V0, %a"},
+            {0xF000, 0xC000, "RND",  "%x, %k"},
+            {0xF000, 0xD000, "DRW",  "%x, %y, %n"},
+            {0xF0FF, 0xE09E, "SKP",  "%x"},
+            {0xF0FF, 0xE0A1, "SKNP", "%x"},
+            {0xFFFF, 0xF000, "LD",   "I, %l", Dialect::XoChip},
+            {0xFFFF, 0xF002, "AUDIO", "", Dialect::XoChip},
+            {0xF0FF, 0xF001, "PLANE", "%p", Dialect::XoChip},
+            {0xF0FF, 0xF007, "LD",   "%x, DT"},
+            {0xF0FF, 0xF00A, "LD",   "%x, K"},
+            {0xF0FF, 0xF015, "LD",   "DT, %x"},
+            {0xF0FF, 0xF018, "LD",   "ST, %x"},
+            {0xF0FF, 0xF01E, "ADD",  "I, %x"},
+            {0xF0FF, 0xF029, "LD",   "F, %x"},
+            {0xF0FF, 0xF030, "LD",   "HF, %x", Dialect::SuperChip},
+            {0xF0FF, 0xF033, "LD",   "B, %x"},
+            {0xF0FF, 0xF055, "LD",   "[I], %x"},
+            {0xF0FF, 0xF065, "LD",   "%x, [I]"},
+            {0xF0FF, 0xF075, "LD",   "R, %x", Dialect::SuperChip},
+            {0xF0FF, 0xF085, "LD",   "%x, R", Dialect::SuperChip},
+            {0xF0FF, 0xF03A, "PITCH", "%x", Dialect::XoChip},
+        };
+        return defs;
+    }
 
-        if (handler)
-            handler(chip8, opcode);
-        else {
-            std::cerr << "Unknown opcode: " << std::hex << opcode << "\n";
-            chip8.set_pc(chip8.get_pc() + 2);
+    const OpcodeInfo* Lookup(uint16_t opcode, Dialect dialect) {
+        // 상위 4비트별 정의 목록 (정의 순서 유지, 처음 호출할 때 한 번 만듦)
+        static const auto groups = [] {
+            std::array<std::vector<const OpcodeInfo*>, 16> result;
+            for (const OpcodeInfo& info : Definitions()) result[info.pattern >> 12].push_back(&info);
+            return result;
+        }();
+        for (const OpcodeInfo* info : groups[opcode >> 12]) {
+            if ((opcode & info->mask) == info->pattern && info->dialect <= dialect) return info;
         }
+        return nullptr;
+    }
+
+    const DispatchTable& Table(Dialect dialect, const Quirks& quirks) {
+        return dialect_tables[static_cast<unsigned int>(dialect)][quirks.mask()];
+    }
+
+    /// @brief 방언 D, quirk 조합 Mask의 테이블 채우기 (핸들러 템플릿을 조합별로 인스턴스화)
+    template <Dialect D, uint8_t Mask>
+    void Fill(DispatchTable& table) {
+        using Q = QuirkTraits<Mask>;
+        table[0x0] = OP_0NNN<D>;
+        table[0x1] = OP_1NNN;
+        table[0x2] = OP_2NNN;
+        table[0x3] = OP_3XNN<D>;
+        table[0x4] = OP_4XNN<D>;
+        table[0x5] = OP_5XYN<D>;
+        table[0x6] = OP_6XNN;
+        table[0x7] = OP_7XNN;
+        table[0x8] = OP_8XYN<Q>;
+        table[0x9] = OP_9XY0<D>;
+        table[0xA] = OP_ANNN;
+        table[0xB] = OP_BNNN<Q>;
+        table[0xC] = OP_CXNN;
+        table[0xD] = OP_DXYN<D, Q>;
+        table[0xE] = OP_EX<D>;
+        table[0xF] = OP_FX<D, Q>;
+    }
+
+    template <Dialect D, uint8_t... Masks>
+    void FillAll(std::array<DispatchTable, NUM_QUIRK_SETS>& tables, std::integer_sequence<uint8_t, Masks...>) {
+        (Fill<D, Masks>(tables[Masks]), ...);
+    }
+
+    /// @brief opcode 상위 4비트 기반으로 방언 x quirk 조합별 핸들러 함수 등록
+    void Initialize() {
+        using AllMasks = std::make_integer_sequence<uint8_t, NUM_QUIRK_SETS>;
+        FillAll<Dialect::Chip8>(dialect_tables[static_cast<unsigned int>(Dialect::Chip8)], AllMasks{});
+        FillAll<Dialect::SuperChip>(dialect_tables[static_cast<unsigned int>(Dialect::SuperChip)], AllMasks{});
+        FillAll<Dialect::XoChip>(dialect_tables[static_cast<unsigned int>(Dialect::XoChip)], AllMasks{});
+    }
+
+    /// @brief opcode를 상위 4비트로 분기하여 실행 (모든 slot이 채워져 있으므로 검사 없이 호출)
+    void Execute(Chip8& chip8, uint16_t opcode) {
+        chip8.dispatch_table()[opcode >> 12](chip8, opcode);
     }
 
 } // namespace opcode_table
\ No newline at end of file
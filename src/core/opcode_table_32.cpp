@@ -1,17 +1,24 @@
 #include "opcode_table_32.hpp"
 #include "chip8_32.hpp"
+#include "common/log.hpp"
+#include "common/swar.hpp"
 
 #include <stdexcept>
-#include <iostream>
 #include <cstring> // memset, memcpy
-#include <random>  // for random operations, CXNN 
-#include <fstream>
 #include <vector>
 
 namespace OpcodeTable_32 {
 
-    // 20개의 주요 명령 그룹(상위 8비트로 구분)을 처리하기 위한 함수 테이블
-    std::array<OpcodeHandler32, 20> primary_table_32;
+    // 상위 8비트(0x00~0xFF) 전체를 덮는 함수 포인터 테이블
+    std::array<OpcodeHandler32, OPCODE_TABLE_SIZE_32> primary_table_32;
+
+    // 패킷(SWAR) 연산 그룹(14XXYYZZ)의 하위 연산 ZZ로 인덱싱하는 별도 테이블
+    std::array<OpcodeHandler32, PACKED_TABLE_SIZE_32> packed_table_32;
+
+    void OP_UNIMPLEMENTED(Chip8_32& chip8_32, uint32_t opcode) {
+        LOG_WARN(Cpu32, "Unimplemented 32-bit opcode: 0x%08X", opcode);
+        chip8_32.set_pc(chip8_32.get_pc() + 4);
+    }
 
     /// @brief 화면을 지우는 명령 (00000E00)
     void OP_00000E00(Chip8_32& chip8_32, uint32_t) {
@@ -20,28 +27,34 @@ namespace OpcodeTable_32 {
         chip8_32.set_pc(chip8_32.get_pc() + 4); 
     }
 
+    /// @brief 화면 모드 전환 (00000F0M): M = 0 → 64x32, 1 → 128x64, 2 → 256x128
+    void OP_00000F0M(Chip8_32& chip8_32, uint32_t opcode) {
+        chip8_32.set_video_mode(static_cast<VideoMode32>(opcode & 0x3));
+        chip8_32.set_pc(chip8_32.get_pc() + 4);
+    }
+
     /// @brief 서브루틴 반환 명령 (00000E0E)
     void OP_00000E0E(Chip8_32& chip8_32, uint32_t) {
         // 스택 언더플로우 체크 필요
         if (chip8_32.get_sp() == 0) {
-            std::cerr << "Stack underflow!" << std::endl;
+            LOG_WARN(Cpu32, "Stack underflow at PC=0x%X", chip8_32.get_pc());
             chip8_32.set_pc(chip8_32.get_pc() + 4);
             return;
         }
 
         chip8_32.set_sp(chip8_32.get_sp() - 1);
-        chip8_32.set_pc(chip8_32.stack_at(chip8_32.get_sp()));  // +4 제거 - 스택에서 정확한 반환 주소 사용
+        chip8_32.jump_to(chip8_32.stack_at(chip8_32.get_sp()));  // +4 제거 - 스택에서 정확한 반환 주소 사용
     }
 
     /// @brief 절대 주소로 점프 (1NNN)
     void OP_01NNNNNN(Chip8_32& chip8_32, uint32_t opcode) {
-        chip8_32.set_pc(opcode & 0x00FFFFFF);  //24비트 주소 추출
+        chip8_32.jump_to(opcode & 0x00FFFFFF);  //24비트 주소 추출
     }
 
     /// @brief 서브루틴 호출 (02NNNNNN)
     void OP_02NNNNNN(Chip8_32& chip8_32, uint32_t opcode) {
         if (chip8_32.get_sp() >= STACK_SIZE_32) {
-            std::cerr << "Stack overflow!" << std::endl;
+            LOG_WARN(Cpu32, "Stack overflow at PC=0x%X", chip8_32.get_pc());
             chip8_32.set_pc(chip8_32.get_pc() + 4);
             return;
          }
@@ -49,7 +62,7 @@ namespace OpcodeTable_32 {
         // 현재 PC 저장 (다음 명령어 주소)
         chip8_32.stack_at(chip8_32.get_sp()) = chip8_32.get_pc() + 4;
         chip8_32.set_sp(chip8_32.get_sp() + 1);
-        chip8_32.set_pc(opcode & 0x00FFFFFF);
+        chip8_32.jump_to(opcode & 0x00FFFFFF);
     }
 
     /// @brief Rx == KKKK(상수)면 다음 명령어 건너뜀 (03XXKKKK)
@@ -57,7 +70,7 @@ namespace OpcodeTable_32 {
         uint8_t x = (opcode & 0x00FF0000) >> 16;  // 레지스터 인덱스 수정
     
         if (x >= 32) {
-            std::cerr << "Register index out of bounds: " << static_cast<int>(x) << std::endl;
+            LOG_WARN(Cpu32, "Register index out of bounds: %d", x);
             chip8_32.set_pc(chip8_32.get_pc() + 4);
             return;
         }
@@ -68,11 +81,8 @@ namespace OpcodeTable_32 {
         // 💥 원본 CHIP-8과 같은 비교 방식: 하위 16비트만 비교
         bool equal = ((reg_val & 0xFFFF) == kk);
         
-        std::cout << "[DEBUG] OP_03XXKKKK: R[" << static_cast<int>(x) << "]="
-                  << std::hex << reg_val << " (lower 16: " << (reg_val & 0xFFFF)
-                  << "), KK=" << kk
-                  << ", Equal=" << equal
-                  << std::dec << std::endl;
+        LOG_TRACE(Cpu32, "OP_03XXKKKK: R[%d]=%X (lower 16: %X), KK=%X, Equal=%d",
+                  x, reg_val, reg_val & 0xFFFF, kk, equal);
     
         chip8_32.set_pc(chip8_32.get_pc() + (equal ? 8 : 4));
     }
@@ -147,6 +157,9 @@ namespace OpcodeTable_32 {
                 chip8_32.set_R(15, (rx & 0x80000000) ? 1: 0);  // MSB를 R15에 저장
                 chip8_32.set_R(x, rx << 1);
                 break;
+            default:
+                OP_UNIMPLEMENTED(chip8_32, opcode);
+                return;
         }
         chip8_32.set_pc(chip8_32.get_pc() + 4);
     }
@@ -167,63 +180,50 @@ namespace OpcodeTable_32 {
 
     /// @brief PC = 주소 NNNNNN + R0 (0BNNNNNN)
     void OP_0BNNNNNN(Chip8_32& chip8_32, uint32_t opcode) {
-        chip8_32.set_pc((opcode & 0x00FFFFFF) + chip8_32.get_R(0));
+        chip8_32.jump_to((opcode & 0x00FFFFFF) + chip8_32.get_R(0));
     }
 
-    /// @brief Rx에 rand() & 상수 kkkk 저장 (0CXXKKKK)
+    /// @brief Rx에 난수 & 상수 kkkk 저장 (0CXXKKKK, 코어별 시드 난수)
     void OP_0CXXKKKK(Chip8_32& chip8_32, uint32_t opcode) {
         uint8_t x = (opcode & 0x00FF0000) >> 16;  // 레지스터 인덱스
         uint32_t mask = static_cast<uint32_t>(opcode & 0x0000FFFF);      // 16비트 마스크
-        uint32_t rand_val = static_cast<uint32_t>(rand() & 0xFFFF);  // 💥 수정: 16비트 랜덤값
+        uint32_t rand_val = chip8_32.random_u16();  // 16비트 랜덤값
 
         chip8_32.set_R(x, rand_val & mask);
         chip8_32.set_pc(chip8_32.get_pc() + 4);
     }
 
-    /// @brief 스프라이트 그리기 (0DXXYYNN) - 💥 주요 수정
+    /// @brief 스프라이트 그리기 (0DXXYYNN)
+    /// 좌표는 현재 화면 모드 크기로 wrap되며, 비용은 스프라이트 높이 NN에만 비례한다.
     void OP_0DXXYYNN(Chip8_32& chip8_32, uint32_t opcode) {
         uint8_t reg_x = (opcode & 0x00FF0000) >> 16;
         uint8_t reg_y = (opcode & 0x0000FF00) >> 8;
+        unsigned int width = chip8_32.video_width();
+        unsigned int height_px = chip8_32.video_height();
 
-        // 💥 수정: 하위 8비트만 사용 (원본 CHIP-8과 동일)
-        uint8_t x = static_cast<uint8_t>(chip8_32.get_R(reg_x) & 0xFF) % VIDEO_WIDTH;   
-        uint8_t y = static_cast<uint8_t>(chip8_32.get_R(reg_y) & 0xFF) % VIDEO_HEIGHT;  
+        // 하위 8비트만 사용 (원본 CHIP-8과 동일, 256x128 모드에서도 전체 좌표 표현 가능)
+        unsigned int x = (chip8_32.get_R(reg_x) & 0xFF) % width;
+        unsigned int y = (chip8_32.get_R(reg_y) & 0xFF) % height_px;
 
         uint8_t height = opcode & 0x000000FF;
-        chip8_32.set_R(15, 0);  // 충돌 감지 플래그 초기화
 
-        for (int row = 0; row < height; ++row) {
-            uint32_t addr = chip8_32.get_I() + row;
+        // 스프라이트 행을 먼저 읽어 두고 (메모리 범위를 벗어나면 거기서 자름) 한 번에 그린다
+        uint8_t rows[256];
+        unsigned int count = 0;
+        for (; count < height; ++count) {
+            uint32_t addr = chip8_32.get_I() + count;
             if (addr >= MEMORY_SIZE_32) {
-                std::cerr << "Memory access out of bounds: " << addr << std::endl;
+                LOG_WARN(Video, "Sprite read out of bounds: 0x%X", addr);
                 break;
             }
-
-            uint8_t sprite = chip8_32.get_memory(addr);
-            for (int col = 0; col < 8; ++col) {
-                if (sprite & (0x80 >> col)) {
-                    // 💥 수정: 화면 경계 처리 개선
-                    uint8_t pixel_x = (x + col) % VIDEO_WIDTH;
-                    uint8_t pixel_y = (y + row) % VIDEO_HEIGHT;
-                    uint32_t video_idx = pixel_y * VIDEO_WIDTH + pixel_x;
-
-                    // 💥 수정: 충돌 감지 로직 개선
-                    if (chip8_32.get_video(video_idx) != 0) {
-                        chip8_32.set_R(15, 1); // 충돌 감지
-                    }
-                    chip8_32.set_video(video_idx, chip8_32.get_video(video_idx) ^ 1);
-                }
-            }
+            rows[count] = chip8_32.get_memory(addr);
         }
 
-        std::cout << "\n=== DRW DEBUG ===" << std::endl;
-        std::cout << "Opcode = 0x" << std::hex << opcode << std::dec << std::endl;
-        std::cout << "reg_x = " << static_cast<int>(reg_x)
-                  << " reg_y = " << static_cast<int>(reg_y) << std::endl;
-        std::cout << "Draw position: (" << static_cast<int>(x) 
-                  << ", " << static_cast<int>(y) << ")" << std::endl;
-        std::cout << "R[15] (Collision Flag) = " << chip8_32.get_R(15) << std::endl;
-        std::cout << "I = 0x" << std::hex << chip8_32.get_I() << std::dec << std::endl;
+        bool collision = frame::xor_sprite(chip8_32.get_video().data(), width, height_px, x, y, rows, count);
+        chip8_32.set_R(15, collision ? 1 : 0);  // 충돌 감지 플래그
+
+        LOG_TRACE(Video, "DRW opcode=0x%08X R%d,R%d at (%u, %u) h=%d collision=%u I=0x%X",
+                  opcode, reg_x, reg_y, x, y, height, chip8_32.get_R(15), chip8_32.get_I());
 
         chip8_32.set_draw_flag(true);
         chip8_32.set_pc(chip8_32.get_pc() + 4);
@@ -233,21 +233,22 @@ namespace OpcodeTable_32 {
     void OP_0EXXCCCC(Chip8_32& chip8_32, uint32_t opcode) {
         uint8_t x = (opcode & 0x00FF0000) >> 16;  // 레지스터 인덱스
         uint8_t key = chip8_32.get_R(x) & 0xFF;   // R 레지스터에서 키 값 (하위 8비트)
-        
+        uint16_t code = opcode & 0x0000FFFF;      // 16비트 조건 코드
+
+        if (code != 0x090E && code != 0x0A01) {
+            OP_UNIMPLEMENTED(chip8_32, opcode);
+            return;
+        }
         if (key >= 16) {
-            std::cerr << "Invalid key index: " << static_cast<int>(key) << std::endl;
+            LOG_WARN(Cpu32, "Invalid key index: %d", key);
             chip8_32.set_pc(chip8_32.get_pc() + 4);
             return;
         }
 
-        uint16_t code = opcode & 0x0000FFFF;      // 16비트 조건 코드
-
         if (code == 0x090E)       // EX9E -> 0EXX090E
             chip8_32.set_pc(chip8_32.get_pc() + (chip8_32.get_key(key) ? 8 : 4));
-        else if (code == 0x0A01)  // EXA1 -> 0EXX0A01
+        else                      // EXA1 -> 0EXX0A01
             chip8_32.set_pc(chip8_32.get_pc() + (!chip8_32.get_key(key) ? 8 : 4));
-        else
-            chip8_32.set_pc(chip8_32.get_pc() + 4);
     }
 
     /// @brief Fx 계열 (타이머/메모리 함수) 확장 명령들 처리 (0FXXCCCC)
@@ -294,13 +295,9 @@ namespace OpcodeTable_32 {
                 chip8_32.set_memory(chip8_32.get_I() + 1, (value / 10) % 10);
                 chip8_32.set_memory(chip8_32.get_I() + 2, value % 10);
                 
-                std::cout << "[BCD] R[" << (int)x << "]=" << value
-                          << " → MEM[" << std::hex << chip8_32.get_I()
-                          << "]=" << (value / 100)
-                          << ", MEM[" << chip8_32.get_I() + 1
-                          << "]=" << ((value / 10) % 10)
-                          << ", MEM[" << chip8_32.get_I() + 2
-                          << "]=" << (value % 10) << std::dec << std::endl;
+                LOG_TRACE(Cpu32, "BCD R[%d]=%u -> MEM[%X]=%u, MEM[%X]=%u, MEM[%X]=%u",
+                          x, value, chip8_32.get_I(), value / 100, chip8_32.get_I() + 1,
+                          (value / 10) % 10, chip8_32.get_I() + 2, value % 10);
                 break;
             }
             case 0x0505:  // FX55 -> 0FXX0505 (Registers 값들 저장) - 💥 수정
@@ -313,23 +310,171 @@ namespace OpcodeTable_32 {
                     chip8_32.set_R(i, chip8_32.get_memory(chip8_32.get_I() + i));  // 8비트 값을 32비트 레지스터에
                 }
                 break;
+            default:
+                OP_UNIMPLEMENTED(chip8_32, opcode);
+                return;
         }
         chip8_32.set_pc(chip8_32.get_pc() + 4);
     }
 
+    /// @brief 블록 메모리 복사 (10XXYY00): MEM[Rx .. Rx+Ry) = MEM[I .. I+Ry)
+    /// 두 영역이 겹치거나 메모리를 벗어나면 복사하지 않고 R15 = 1 (정상 완료 시 R15 = 0)
+    void OP_10XXYY00(Chip8_32& chip8_32, uint32_t opcode) {
+        uint8_t x = (opcode & 0x00FF0000) >> 16;  // 목적지 주소 레지스터
+        uint8_t y = (opcode & 0x0000FF00) >> 8;   // 길이 레지스터
+        uint32_t dst = chip8_32.get_R(x);
+        uint32_t src = chip8_32.get_I();
+        uint32_t len = chip8_32.get_R(y);
+
+        bool overlap = len != 0 && dst < src + len && src < dst + len;
+        bool ok = !overlap && chip8_32.copy_memory(dst, src, len);
+        if (!ok) LOG_WARN(Cpu32, "MEMCPY rejected: dst=0x%X src=0x%X len=%u", dst, src, len);
+        chip8_32.set_R(15, ok ? 0 : 1);
+        chip8_32.set_pc(chip8_32.get_pc() + 4);
+    }
+
+    /// @brief 블록 메모리 채우기 (11XXYYKK): MEM[Rx .. Rx+Ry) = KK
+    /// 메모리를 벗어나면 쓰지 않고 R15 = 1 (정상 완료 시 R15 = 0)
+    void OP_11XXYYKK(Chip8_32& chip8_32, uint32_t opcode) {
+        uint8_t x = (opcode & 0x00FF0000) >> 16;  // 목적지 주소 레지스터
+        uint8_t y = (opcode & 0x0000FF00) >> 8;   // 길이 레지스터
+        uint8_t value = opcode & 0x000000FF;      // 채울 값 (8비트 상수)
+        uint32_t dst = chip8_32.get_R(x);
+        uint32_t len = chip8_32.get_R(y);
+
+        bool ok = chip8_32.fill_memory(dst, value, len);
+        if (!ok) LOG_WARN(Cpu32, "MEMSET rejected: dst=0x%X len=%u", dst, len);
+        chip8_32.set_R(15, ok ? 0 : 1);
+        chip8_32.set_pc(chip8_32.get_pc() + 4);
+    }
+
+    /// @brief 겹침 허용 블록 메모리 이동 (12XXYY00): MEM[Rx .. Rx+Ry) = MEM[I .. I+Ry)
+    /// 메모리를 벗어나면 이동하지 않고 R15 = 1 (정상 완료 시 R15 = 0)
+    void OP_12XXYY00(Chip8_32& chip8_32, uint32_t opcode) {
+        uint8_t x = (opcode & 0x00FF0000) >> 16;
+        uint8_t y = (opcode & 0x0000FF00) >> 8;
+        uint32_t dst = chip8_32.get_R(x);
+        uint32_t src = chip8_32.get_I();
+        uint32_t len = chip8_32.get_R(y);
+
+        bool ok = chip8_32.copy_memory(dst, src, len);
+        if (!ok) LOG_WARN(Cpu32, "MEMMOVE rejected: dst=0x%X src=0x%X len=%u", dst, src, len);
+        chip8_32.set_R(15, ok ? 0 : 1);
+        chip8_32.set_pc(chip8_32.get_pc() + 4);
+    }
+
+    /// @brief Rx = Kernel(Rx, Ry) 형태의 패킷 연산 (14XXYYZZ)
+    template <uint32_t (*Kernel)(uint32_t, uint32_t)>
+    void OP_PACKED(Chip8_32& chip8_32, uint32_t opcode) {
+        uint8_t x = (opcode & 0x00FF0000) >> 16;
+        uint8_t y = (opcode & 0x0000FF00) >> 8;
+        chip8_32.set_R(x, Kernel(chip8_32.get_R(x), chip8_32.get_R(y)));
+        chip8_32.set_pc(chip8_32.get_pc() + 4);
+    }
+
+    /// @brief 8비트 레인 재배치 (14XXYY08): Rx = Rx의 레인들을 Ry 하위 8비트 선택자로 재배치
+    void OP_14XXYY08(Chip8_32& chip8_32, uint32_t opcode) {
+        uint8_t x = (opcode & 0x00FF0000) >> 16;
+        uint8_t y = (opcode & 0x0000FF00) >> 8;
+        chip8_32.set_R(x, swar::shuffle_u8(chip8_32.get_R(x), chip8_32.get_R(y) & 0xFF));
+        chip8_32.set_pc(chip8_32.get_pc() + 4);
+    }
+
+    /// @brief 8비트 레인별 1비트 개수 (14XXYY09): Rx = popcount(Ry의 각 레인)
+    void OP_14XXYY09(Chip8_32& chip8_32, uint32_t opcode) {
+        uint8_t x = (opcode & 0x00FF0000) >> 16;
+        uint8_t y = (opcode & 0x0000FF00) >> 8;
+        chip8_32.set_R(x, swar::popcount_u8(chip8_32.get_R(y)));
+        chip8_32.set_pc(chip8_32.get_pc() + 4);
+    }
+
+    /// @brief 패킷 연산 그룹 (14XXYYZZ): 하위 8비트 ZZ로 packed_table_32에서 한 번 더 분기
+    void OP_14XXYYZZ(Chip8_32& chip8_32, uint32_t opcode) {
+        packed_table_32[opcode & 0xFF](chip8_32, opcode);
+    }
+
+    /// @brief 위 핸들러들이 처리하는 명령어 정의 (mask, pattern, 니모닉, 피연산자 서식)
+    const std::vector<OpcodeInfo32>& Definitions() {
+        static const std::vector<OpcodeInfo32> defs = {
+            {0xFFFFFFFF, 0x00000E00, "CLS",  ""},
+            {0xFFFFFFFF, 0x00000E0E, "RET",  ""},
+            {0xFFFFFFFF, 0x00000F00, "MODE", "64x32"},
+            {0xFFFFFFFF, 0x00000F01, "MODE", "128x64"},
+            {0xFFFFFFFF, 0x00000F02, "MODE", "256x128"},
+            {0xFF000000, 0x01000000, "JP",   "%a"},
+            {0xFF000000, 0x02000000, "CALL", "%a"},
+            {0xFF000000, 0x03000000, "SE",   "%x, %k"},
+            {0xFF000000, 0x04000000, "SNE",  "%x, %k"},
+            {0xFF000000, 0x05000000, "SE",   "%x, %y"},
+            {0xFF000000, 0x06000000, "LD",   "%x, %k"},
+            {0xFF000000, 0x07000000, "ADD",  "%x, %k"},
+            {0xFF0000FF, 0x08000000, "LD",   "%x, %y"},
+            {0xFF0000FF, 0x08000001, "OR",   "%x, %y"},
+            {0xFF0000FF, 0x08000002, "AND",  "%x, %y"},
+            {0xFF0000FF, 0x08000003, "XOR",  "%x, %y"},
+            {0xFF0000FF, 0x08000004, "ADD",  "%x, %y"},
+            {0xFF0000FF, 0x08000005, "SUB",  "%x, %y"},
+            {0xFF0000FF, 0x08000006, "SHR",  "%x"},
+            {0xFF0000FF, 0x08000007, "SUBN", "%x, %y"},
+            {0xFF0000FF, 0x0800000E, "SHL",  "%x"},
+            {0xFF000000, 0x09000000, "SNE",  "%x, %y"},
+            {0xFF000000, 0x0A000000, "LD",   "I, %a"},
+            {0xFF000000, 0x0B000000, "JP",   "R0, %a"},
+            {0xFF000000, 0x0C000000, "RND",  "%x, %k"},
+            {0xFF000000, 0x0D000000, "DRW",  "%x, %y, %n"},
+            {0xFF00FFFF, 0x0E00090E, "SKP",  "%x"},
+            {0xFF00FFFF, 0x0E000A01, "SKNP", "%x"},
+            {0xFF00FFFF, 0x0F000007, "LD",   "%x, DT"},
+            {0xFF00FFFF, 0x0F00000A, "LD",   "%x, K"},
+            {0xFF00FFFF, 0x0F000105, "LD",   "DT, %x"},
+            {0xFF00FFFF, 0x0F000108, "LD",   "ST, %x"},
+            {0xFF00FFFF, 0x0F00010E, "ADD",  "I, %x"},
+            {0xFF00FFFF, 0x0F000209, "LD",   "F, %x"},
+            {0xFF00FFFF, 0x0F000303, "LD",   "B, %x"},
+            {0xFF00FFFF, 0x0F000505, "LD",   "[I], %x"},
+            {0xFF00FFFF, 0x0F000605, "LD",   "%x, [I]"},
+            {0xFF000000, 0x10000000, "MEMCPY",  "%x, I, %y"},
+            {0xFF000000, 0x11000000, "MEMSET",  "%x, %y, %b"},
+            {0xFF000000, 0x12000000, "MEMMOVE", "%x, I, %y"},
+            {0xFF0000FF, 0x14000000, "PADDUSB", "%x, %y"},
+            {0xFF0000FF, 0x14000001, "PSUBUSB", "%x, %y"},
+            {0xFF0000FF, 0x14000002, "PADDUSW", "%x, %y"},
+            {0xFF0000FF, 0x14000003, "PSUBUSW", "%x, %y"},
+            {0xFF0000FF, 0x14000004, "PCMPEQB", "%x, %y"},
+            {0xFF0000FF, 0x14000005, "PCMPGTB", "%x, %y"},
+            {0xFF0000FF, 0x14000006, "PCMPEQW", "%x, %y"},
+            {0xFF0000FF, 0x14000007, "PCMPGTW", "%x, %y"},
+            {0xFF0000FF, 0x14000008, "PSHUFB",  "%x, %y"},
+            {0xFF0000FF, 0x14000009, "PCNTB",   "%x, %y"},
+        };
+        return defs;
+    }
+
+    const OpcodeInfo32* Lookup(uint32_t opcode) {
+        // 상위 8비트별 정의 목록 (정의 순서 유지, 처음 호출할 때 한 번 만듦)
+        static const auto groups = [] {
+            std::array<std::vector<const OpcodeInfo32*>, OPCODE_TABLE_SIZE_32> result;
+            for (const OpcodeInfo32& info : Definitions()) result[info.pattern >> 24].push_back(&info);
+            return result;
+        }();
+        for (const OpcodeInfo32* info : groups[opcode >> 24]) {
+            if ((opcode & info->mask) == info->pattern) return info;
+        }
+        return nullptr;
+    }
+
     /// @brief opcode 상위 8비트 기반으로 핸들러 함수 등록
     void Initialize() {
-        primary_table_32.fill(nullptr);
+        primary_table_32.fill(OP_UNIMPLEMENTED);
 
         primary_table_32[0x00] = [](Chip8_32& chip8_32, uint32_t opcode) {
-            uint16_t code = opcode & 0x0000FFFF;  // 세부 코드 
-            switch (code) {
-                case 0x0E00: OP_00000E00(chip8_32, opcode); break;
-                case 0x0E0E: OP_00000E0E(chip8_32, opcode); break;
-                default:
-                    std::cerr << "Unknown 0x00 opcode: 0x" << std::hex << opcode << "\n";
-                    chip8_32.set_pc(chip8_32.get_pc() + 4);
-                    break;
+            switch (opcode) {  // 상위 8비트가 0이므로 opcode 전체가 세부 코드
+                case 0x00000E00: OP_00000E00(chip8_32, opcode); break;
+                case 0x00000E0E: OP_00000E0E(chip8_32, opcode); break;
+                case 0x00000F00:
+                case 0x00000F01:
+                case 0x00000F02: OP_00000F0M(chip8_32, opcode); break;
+                default: OP_UNIMPLEMENTED(chip8_32, opcode); break;
             }
         };
 
@@ -348,26 +493,29 @@ namespace OpcodeTable_32 {
         primary_table_32[0x0D] = OP_0DXXYYNN;  // 스프라이트 그리기
         primary_table_32[0x0E] = OP_0EXXCCCC;  // 키 입력 조건 분기
         primary_table_32[0x0F] = OP_0FXXCCCC;  // Fx 계열 (타이머/메모리 함수) 확장 명령들 처리
+        primary_table_32[0x10] = OP_10XXYY00;  // MEMCPY: I → Rx 주소로 Ry 바이트 복사 (겹침 불가)
+        primary_table_32[0x11] = OP_11XXYYKK;  // MEMSET: Rx 주소부터 Ry 바이트를 KK로 채움
+        primary_table_32[0x12] = OP_12XXYY00;  // MEMMOVE: I → Rx 주소로 Ry 바이트 이동 (겹침 허용)
+        // 0x13: 블록 메모리 그룹 예약
+        primary_table_32[0x14] = OP_14XXYYZZ;  // 패킷(8/16비트 레인) 연산 그룹 → packed_table_32
+
+        // 패킷 연산 하위 테이블 (ZZ). 레인 0 = 최하위 바이트/워드, 부호 없는 포화 연산
+        packed_table_32.fill(OP_UNIMPLEMENTED);
+        packed_table_32[0x00] = OP_PACKED<swar::add_sat_u8>;    // PADDUSB: 8비트 레인 포화 덧셈
+        packed_table_32[0x01] = OP_PACKED<swar::sub_sat_u8>;    // PSUBUSB: 8비트 레인 포화 뺄셈
+        packed_table_32[0x02] = OP_PACKED<swar::add_sat_u16>;   // PADDUSW: 16비트 레인 포화 덧셈
+        packed_table_32[0x03] = OP_PACKED<swar::sub_sat_u16>;   // PSUBUSW: 16비트 레인 포화 뺄셈
+        packed_table_32[0x04] = OP_PACKED<swar::cmp_eq_u8>;     // PCMPEQB: 같은 레인 0xFF
+        packed_table_32[0x05] = OP_PACKED<swar::cmp_gt_u8>;     // PCMPGTB: Rx > Ry인 레인 0xFF
+        packed_table_32[0x06] = OP_PACKED<swar::cmp_eq_u16>;    // PCMPEQW: 같은 레인 0xFFFF
+        packed_table_32[0x07] = OP_PACKED<swar::cmp_gt_u16>;    // PCMPGTW: Rx > Ry인 레인 0xFFFF
+        packed_table_32[0x08] = OP_14XXYY08;                    // PSHUFB: 레인 재배치
+        packed_table_32[0x09] = OP_14XXYY09;                    // PCNTB: 레인별 popcount
     }
 
-    /// @brief opcode를 상위 8비트로 분기하여 실행
+    /// @brief opcode를 상위 8비트로 분기하여 실행 (모든 slot이 채워져 있으므로 검사 없이 호출)
     void Execute(Chip8_32& chip8_32, uint32_t opcode) {
-        uint8_t index = (opcode & 0xFF000000) >> 24;
-    
-        // 실제 구현된 명령어만 처리 (0x00~0x0F, 총 16개)
-        if (index >= IMPLEMENTED_OPCODES) {
-            std::cerr << "Unimplemented 32-bit opcode: " << std::hex << opcode << "\n";
-            chip8_32.set_pc(chip8_32.get_pc() + 4);
-            return;
-        }
-        
-        OpcodeHandler32 handler = primary_table_32[index];
-        if (handler)
-            handler(chip8_32, opcode);
-        else {
-            std::cerr << "Unknown 32-bit opcode: " << std::hex << opcode << "\n";
-            chip8_32.set_pc(chip8_32.get_pc() + 4);
-        }
+        primary_table_32[opcode >> 24](chip8_32, opcode);
     }
 
 } // namespace OpcodeTable_32
\ No newline at end of file
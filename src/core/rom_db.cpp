@@ -0,0 +1,114 @@
+#include "rom_db.hpp"
+#include "common/log.hpp"
+#include "common/rom_loader.hpp"
+#include "common/xxhash.hpp"
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+namespace {
+
+// 한 줄 파싱 (빈 줄/주석이면 true, key == 0)
+bool parse_line(const std::string& line, uint64_t& key, RomProfile& profile) {
+    std::istringstream iss(line);
+    std::string word;
+    key = 0;
+    if (!(iss >> word) || word[0] == '#') return true;
+
+    char* end = nullptr;
+    key = std::strtoull(word.c_str(), &end, 16);
+    if (*end != '\0' || word.size() != 16) return false;
+
+    while (iss >> word) {
+        const std::size_t eq = word.find('=');
+        if (eq == std::string::npos) return false;
+        const std::string name = word.substr(0, eq);
+        const std::string value = word.substr(eq + 1);
+        if (name == "name") {
+            profile.name = value;
+        } else if (name == "ipf") {
+            unsigned long ipf = std::strtoul(value.c_str(), &end, 10);
+            if (*end != '\0' || ipf == 0 || ipf > 1000000) return false;
+            profile.ipf = static_cast<unsigned int>(ipf);
+        } else if (name == "dialect") {
+            if (!parse_dialect(value, profile.dialect)) return false;
+            profile.has_dialect = true;
+        } else if (name == "quirks") {
+            if (!parse_quirks(value, profile.quirks)) return false;
+            profile.has_quirks = true;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+uint64_t RomDatabase::hash(const uint8_t* data, std::size_t size) {
+    return xxhash::hash64(data, size);
+}
+
+bool RomDatabase::load(const std::string& path) {
+    RomImage file;
+    if (file.open(path.c_str()) != RomError::None) return false;
+    [[maybe_unused]] std::size_t errors = parse(reinterpret_cast<const char*>(file.data()), file.size(), path);
+    LOG_DEBUG(General, "ROM database %s: %zu entries, %zu invalid lines", path.c_str(), entries_.size(), errors);
+    return true;
+}
+
+std::size_t RomDatabase::parse(const char* text, std::size_t size, const std::string& source) {
+    std::size_t errors = 0;
+    std::size_t line_no = 0;
+    std::size_t start = 0;
+    while (start < size) {
+        std::size_t end = start;
+        while (end < size && text[end] != '\n') ++end;
+        ++line_no;
+
+        std::string line(text + start, end - start);
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        uint64_t key;
+        RomProfile profile;
+        if (!parse_line(line, key, profile)) {
+            LOG_WARN(General, "%s:%zu: invalid ROM profile line", source.c_str(), line_no);
+            ++errors;
+        } else if (key != 0) {
+            entries_[key] = profile;  // 뒤에 나온 줄이 우선
+        }
+        start = end + 1;
+    }
+    return errors;
+}
+
+const RomProfile* RomDatabase::find(uint64_t hash) const {
+    auto it = entries_.find(hash);
+    return it != entries_.end() ? &it->second : nullptr;
+}
+
+std::string RomDatabase::format_line(uint64_t hash, const RomProfile& profile) {
+    char key[17];
+    std::snprintf(key, sizeof(key), "%016" PRIx64, hash);
+    std::string line = key;
+    if (!profile.name.empty()) {
+        std::string name = profile.name;
+        for (char& c : name) {
+            if (c == ' ' || c == '\t') c = '_';  // 공백은 항목 구분자
+        }
+        line += " name=" + name;
+    }
+    if (profile.ipf) line += " ipf=" + std::to_string(profile.ipf);
+    if (profile.has_dialect) line += std::string(" dialect=") + dialect_key(profile.dialect);
+    if (profile.has_quirks) line += " quirks=" + quirks_name(profile.quirks);
+    return line;
+}
+
+bool RomDatabase::append(const std::string& path, uint64_t hash, const RomProfile& profile) {
+    std::ofstream out(path, std::ios::app);
+    if (!out) return false;
+    out << format_line(hash, profile) << "\n";
+    return static_cast<bool>(out);
+}
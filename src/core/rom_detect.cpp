@@ -0,0 +1,85 @@
+#include "rom_detect.hpp"
+#include "chip8.hpp"
+#include "opcode_table.hpp"
+#include "opcode_table_32.hpp"
+#include "common/byte_order.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace {
+
+// 점수 차이가 이보다 작으면 내용만으로는 확신하지 않음
+constexpr float CONFIDENT_MARGIN = 0.25f;
+
+// 4의 배수가 아닌 크기의 32비트 점수 감점 (패딩 없이 잘린 ROM도 있어 배제하지는 않음)
+constexpr float MISALIGNED_PENALTY = 0.1f;
+
+// 확장 방언으로 판정하는 데 필요한 전용 명령어 수 (스프라이트 데이터가 우연히 맞는 경우 제외)
+constexpr unsigned int DIALECT_MIN_HITS = 2;
+
+// 8비트 명령어가 처음 등장한 방언 (정의 목록의 dialect)
+// DXY0(16x16 스프라이트)와 00CN/00DN(세로 스크롤)은 스프라이트 데이터에서 흔히 우연히 맞으므로 단서로 쓰지 않는다.
+// 이 명령을 쓰는 프로그램은 거의 항상 00FF(고해상도) 등 다른 전용 명령도 함께 쓴다.
+Dialect required_dialect(const OpcodeTable::OpcodeInfo& info) {
+    return info.mask == 0xFFF0 ? Dialect::Chip8 : info.dialect;  // 00CN / 00DN
+}
+
+bool read_header(const uint8_t* data, std::size_t size, RomDetection& result) {
+    if (size < ROM_HEADER_SIZE || std::memcmp(data, ROM_HEADER_MAGIC, sizeof(ROM_HEADER_MAGIC)) != 0) return false;
+    if (data[4] > 1 || data[5] >= NUM_DIALECTS) return false;
+    result.kind = data[4] == 0 ? RomKind::Chip8 : RomKind::Chip8_32;
+    result.dialect = static_cast<Dialect>(data[5]);
+    result.offset = ROM_HEADER_SIZE;
+    result.from_header = true;
+    result.confident = true;
+    return true;
+}
+
+} // namespace
+
+RomDetection detect_rom(const uint8_t* data, std::size_t size) {
+    RomDetection result;
+    if (read_header(data, size, result)) return result;
+
+    const std::size_t scan = std::min(size, DETECT_SCAN_BYTES);
+
+    // 8비트: 2바이트 명령어
+    unsigned int words_8 = 0, valid_8 = 0;
+    unsigned int dialect_hits[NUM_DIALECTS] = {};
+    for (std::size_t i = 0; i + 2 <= scan; i += 2) {
+        const uint16_t opcode = static_cast<uint16_t>((data[i] << 8) | data[i + 1]);
+        if (opcode == 0) continue;
+        ++words_8;
+        const OpcodeTable::OpcodeInfo* info = OpcodeTable::Lookup(opcode);
+        if (!info || info->pattern == 0x0000) continue;  // 미정의 또는 SYS
+        ++valid_8;
+        ++dialect_hits[static_cast<unsigned int>(required_dialect(*info))];
+    }
+
+    // 32비트: 4바이트 정렬 명령어
+    unsigned int words_32 = 0, valid_32 = 0;
+    for (std::size_t i = 0; i + 4 <= scan; i += 4) {
+        const uint32_t opcode = load_be32(data + i);
+        if (opcode == 0) continue;
+        ++words_32;
+        if (OpcodeTable_32::Lookup(opcode)) ++valid_32;
+    }
+
+    result.score_8 = words_8 ? static_cast<float>(valid_8) / words_8 : 0.0f;
+    result.score_32 = words_32 ? static_cast<float>(valid_32) / words_32 : 0.0f;
+    if (size % 4 != 0) result.score_32 = std::max(0.0f, result.score_32 - MISALIGNED_PENALTY);
+
+    result.kind = result.score_32 > result.score_8 ? RomKind::Chip8_32 : RomKind::Chip8;
+    result.confident = std::abs(result.score_32 - result.score_8) >= CONFIDENT_MARGIN;
+
+    if (result.kind == RomKind::Chip8) {
+        if (size > MEMORY_SIZE - 0x200 || dialect_hits[static_cast<unsigned int>(Dialect::XoChip)] >= DIALECT_MIN_HITS) {
+            result.dialect = Dialect::XoChip;
+        } else if (dialect_hits[static_cast<unsigned int>(Dialect::SuperChip)] >= DIALECT_MIN_HITS) {
+            result.dialect = Dialect::SuperChip;
+        }
+    }
+    return result;
+}
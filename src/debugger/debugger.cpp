@@ -4,6 +4,7 @@
 #include <iostream>
 #include <sstream>
 #include <iomanip>
+#include <vector>
 
 namespace chip8emu {
 
@@ -27,10 +28,267 @@ std::string toHex32(uint32_t value) {
     return oss.str();
 }
 
+// === 워치포인트 공통 처리 ===
+namespace {
+
+const char* watchKindName(WatchKind kind) {
+    switch (kind) {
+        case WatchKind::Read: return "read";
+        case WatchKind::Write: return "write";
+        default: return "access";
+    }
+}
+
+/// @brief 0x 접두사면 16진수, 아니면 10진수 (0으로 시작해도 8진수로 읽지 않음)
+unsigned long parseNumber(const std::string& token) {
+    if (token.size() > 2 && token[0] == '0' && (token[1] == 'x' || token[1] == 'X')) {
+        return std::stoul(token.substr(2), nullptr, 16);
+    }
+    return std::stoul(token, nullptr, 10);
+}
+
+std::string formatAddress(uint32_t address, bool wide) {
+    return wide ? toHex32(address) : toHex16(static_cast<uint16_t>(address));
+}
+
+/// @brief 직전 명령어에서 발생한 워치포인트 히트 출력 (히트가 있었으면 true)
+template <std::size_t N>
+bool reportWatchHits(MemoryWatch<N>& watch, bool wide) {
+    if (!watch.has_hits()) return false;
+    for (const WatchHit& hit : watch.take_hits()) {
+        std::cout << "\n👁️  WATCHPOINT (" << watchKindName(hit.kind) << ") at "
+                  << formatAddress(hit.address, wide) << " by PC=" << formatAddress(hit.pc, wide);
+        if (hit.kind == WatchKind::Write) {
+            std::cout << "  " << toHex8(hit.old_value) << " → " << toHex8(hit.new_value);
+        } else {
+            std::cout << "  value=" << toHex8(hit.new_value);
+        }
+        std::cout << "\n";
+    }
+    return true;
+}
+
+/**
+ * @brief 워치포인트 명령 처리: wp/rwp/awp <addr> [len] [=value], wd <addr>, wl
+ * @return 워치포인트 명령이었으면 true
+ */
+template <std::size_t N>
+bool handleWatchCommand(const std::string& input, MemoryWatch<N>& watch, bool wide) {
+    std::istringstream iss(input);
+    std::string cmd;
+    iss >> cmd;
+
+    WatchKind kind;
+    if (cmd == "wp") kind = WatchKind::Write;
+    else if (cmd == "rwp") kind = WatchKind::Read;
+    else if (cmd == "awp") kind = WatchKind::Access;
+    else if (cmd == "wl") {
+        if (watch.points().empty()) std::cout << "(no watchpoints)\n";
+        for (const Watchpoint& wp : watch.points()) {
+            std::cout << "  " << formatAddress(wp.address, wide) << " len=" << std::dec << wp.length
+                      << " " << watchKindName(wp.kind);
+            if (wp.value) std::cout << " =" << toHex8(*wp.value);
+            std::cout << "\n";
+        }
+        return true;
+    } else if (cmd == "wd") {
+        std::string token;
+        try {
+            if (!(iss >> token)) throw std::invalid_argument("address");
+            uint32_t addr = static_cast<uint32_t>(std::stoul(token, nullptr, 16));
+            if (watch.remove(addr)) std::cout << "🗑️  Watchpoint removed at " << formatAddress(addr, wide) << "\n";
+            else std::cout << "❌ No watchpoint at " << formatAddress(addr, wide) << "\n";
+        } catch (...) {
+            std::cout << "❌ Invalid address format. Use: wd 0x300\n";
+        }
+        return true;
+    } else {
+        return false;
+    }
+
+    std::string token;
+    try {
+        if (!(iss >> token)) throw std::invalid_argument("address");
+        Watchpoint wp{static_cast<uint32_t>(std::stoul(token, nullptr, 16)), 1, kind, std::nullopt};
+        while (iss >> token) {
+            if (token[0] == '=') wp.value = static_cast<uint8_t>(parseNumber(token.substr(1)));
+            else wp.length = static_cast<uint32_t>(parseNumber(token));
+        }
+        if (wp.address >= N || wp.length == 0 || wp.length > N - wp.address) {
+            std::cout << "❌ Watch range out of memory\n";
+            return true;
+        }
+        watch.add(wp);
+        std::cout << "👁️  Watchpoint (" << watchKindName(kind) << ") set at "
+                  << formatAddress(wp.address, wide) << " len=" << std::dec << wp.length << "\n";
+    } catch (...) {
+        std::cout << "❌ Invalid format. Use: " << cmd << " 0x300 [len] [=value]\n";
+    }
+    return true;
+}
+
+/// @brief 현재 PC의 브레이크포인트/트레이스포인트 평가 (멈춰야 하면 true)
+template <class Core>
+bool evaluateBreakpoint(BreakpointTable& table, const Core& core, uint32_t pc, bool wide) {
+    Breakpoint* bp = table.find(pc);
+    if (!bp) return false;
+    if (bp->condition && !bp->condition->test(core)) return false;
+    ++bp->hit_count;
+
+    if (!bp->trace) {
+        std::cout << "\n🚨 BREAKPOINT HIT at " << formatAddress(pc, wide);
+        if (bp->condition) std::cout << " [" << bp->condition->source() << "]";
+        std::cout << " 🚨\n";
+        return true;
+    }
+
+    // 트레이스포인트: 한 줄 기록 후 계속 실행
+    std::cout << "📝 TRACE " << formatAddress(pc, wide) << " #" << std::dec << bp->hit_count;
+    for (const Expression& expr : bp->trace_exprs) {
+        std::cout << "  " << expr.source() << "=" << toHex32(expr.evaluate(core));
+    }
+    std::cout << "\n";
+    return false;
+}
+
+/// @brief 앞뒤 공백 제거
+std::string trim(const std::string& text) {
+    std::size_t begin = text.find_first_not_of(" \t");
+    if (begin == std::string::npos) return "";
+    std::size_t end = text.find_last_not_of(" \t");
+    return text.substr(begin, end - begin + 1);
+}
+
+/**
+ * @brief 브레이크포인트 명령 처리
+ *   bp <addr> [if <cond>]                  - (조건부) 브레이크포인트
+ *   tp <addr> [if <cond>] [: expr, ...]    - 트레이스포인트 (멈추지 않고 기록)
+ *   bd <addr>, bl                          - 삭제 / 목록
+ * @return 브레이크포인트 명령이었으면 true
+ */
+bool handleBreakpointCommand(const std::string& input, BreakpointTable& table,
+                             Expression::Isa isa, bool wide) {
+    std::istringstream iss(input);
+    std::string cmd;
+    iss >> cmd;
+
+    if (cmd == "bl") {
+        if (table.entries().empty()) std::cout << "(no breakpoints)\n";
+        for (const auto& [addr, bp] : table.entries()) {
+            std::cout << "  " << formatAddress(addr, wide) << (bp.trace ? " trace" : " break");
+            if (bp.condition) std::cout << " if " << bp.condition->source();
+            std::cout << "  hits=" << std::dec << bp.hit_count << "\n";
+        }
+        return true;
+    }
+    if (cmd != "bp" && cmd != "tp" && cmd != "bd") return false;
+
+    std::string token;
+    uint32_t addr = 0;
+    try {
+        if (!(iss >> token)) throw std::invalid_argument("address");
+        addr = static_cast<uint32_t>(std::stoul(token, nullptr, 16));
+    } catch (...) {
+        std::cout << "❌ Invalid address format. Use: " << cmd << " 0x200\n";
+        return true;
+    }
+
+    if (cmd == "bd") {
+        if (table.remove(addr)) std::cout << "🗑️  Breakpoint removed at " << formatAddress(addr, wide) << "\n";
+        else std::cout << "❌ No breakpoint at " << formatAddress(addr, wide) << "\n";
+        return true;
+    }
+
+    std::string rest;
+    std::getline(iss, rest);
+    std::string cond_src = trim(rest);
+    std::string trace_src;
+    if (cmd == "tp") {
+        std::size_t colon = cond_src.find(':');
+        if (colon != std::string::npos) {
+            trace_src = cond_src.substr(colon + 1);
+            cond_src = trim(cond_src.substr(0, colon));
+        }
+    }
+
+    Breakpoint bp;
+    bp.trace = (cmd == "tp");
+    std::string error;
+    if (!cond_src.empty()) {
+        if (cond_src.compare(0, 3, "if ") != 0) {
+            std::cout << "❌ Expected 'if <condition>' after address\n";
+            return true;
+        }
+        bp.condition = Expression::compile(trim(cond_src.substr(3)), isa, &error);
+        if (!bp.condition) {
+            std::cout << "❌ Condition error: " << error << "\n";
+            return true;
+        }
+    }
+
+    std::istringstream exprs(trace_src);
+    std::string expr_src;
+    while (std::getline(exprs, expr_src, ',')) {
+        expr_src = trim(expr_src);
+        if (expr_src.empty()) continue;
+        std::optional<Expression> expr = Expression::compile(expr_src, isa, &error);
+        if (!expr) {
+            std::cout << "❌ Trace expression error: " << error << "\n";
+            return true;
+        }
+        bp.trace_exprs.push_back(std::move(*expr));
+    }
+
+    table.add(addr, std::move(bp));
+    std::cout << (cmd == "tp" ? "📝 Tracepoint set at " : "📍 Breakpoint set at ")
+              << formatAddress(addr, wide) << "\n";
+    return true;
+}
+
+} // namespace
+
 // ===============================================
 // 8비트 디버거 구현
 // ===============================================
 
+Debugger8::Debugger8(Chip8& chip8)
+    : chip8_(chip8), enabled_(false), step_mode_(false), breakpoints_(MEMORY_SIZE_XO),
+      disasm_(Isa::Chip8, MEMORY_SIZE_XO, chip8.get_dialect()) {}
+
+Debugger8::~Debugger8() {
+    chip8_.set_debug_hook(DebugHook{});
+}
+
+void Debugger8::enable(bool on) {
+    enabled_ = on;
+    // 꺼져 있으면 훅을 떼어 명령어 루프의 검사 비용을 없앰
+    chip8_.set_debug_hook(on ? DebugHook{&breakpoints_.mask(), &Debugger8::breakHook, this} : DebugHook{});
+}
+
+bool Debugger8::breakHook(void* self, uint32_t pc) {
+    return static_cast<Debugger8*>(self)->checkBreak(pc);
+}
+
+// 연속 실행 중 명령어 루프에서 호출 (브레이크포인트 주소이거나 워치포인트 히트가 있을 때만, true = 멈춤)
+bool Debugger8::checkBreak(uint32_t pc) {
+    // 스텝 모드에서는 printState가 명령어마다 같은 검사를 함
+    if (!enabled_ || step_mode_) return false;
+
+    bool stop = reportWatchHits(chip8_.memory_watch(), false);
+
+    // continue 직후에는 방금 멈췄던 브레이크포인트에서 다시 멈추지 않음
+    const bool resumed_here = resuming_ && resume_pc_ == pc;
+    resuming_ = false;
+    if (!resumed_here && evaluateBreakpoint(breakpoints_, chip8_, pc, false)) {
+        stop = true;
+    }
+    if (stop) {
+        step_mode_ = true;
+        break_checked_ = true;
+    }
+    return stop;
+}
+
 std::string Debugger8::toHex8(uint8_t value) const {
     return ::chip8emu::toHex8(value);
 }
@@ -43,23 +301,39 @@ std::string Debugger8::toHex32(uint32_t value) const {
     return ::chip8emu::toHex32(value);
 }
 
+void Debugger8::addWatchpoint(const Watchpoint& wp) {
+    chip8_.memory_watch().add(wp);
+}
+
+bool Debugger8::removeWatchpoint(uint32_t address) {
+    return chip8_.memory_watch().remove(address);
+}
+
+void Debugger8::clearWatchpoints() {
+    chip8_.memory_watch().clear();
+}
+
 void Debugger8::printState(uint32_t opcode) {
-    if (!enabled_) return;
+    // 연속 실행 중에는 명령어 루프의 훅(checkBreak)이 검사하므로 상태 출력 없이 진행
+    if (!enabled_ || !step_mode_) return;
+
+    // 워치포인트 체크 (직전 명령어의 메모리 접근)
+    reportWatchHits(chip8_.memory_watch(), false);
 
-    // 브레이크포인트 체크
+    // 브레이크포인트/트레이스포인트 체크 (훅에서 평가하고 멈춘 경우는 다시 평가하지 않음)
     uint16_t pc = chip8_.get_pc();
-    if (hasBreakpoint(pc)) {
-        std::cout << "\n🚨 BREAKPOINT HIT at " << toHex16(pc) << " 🚨\n";
-        step_mode_ = true;
-    }
+    if (!break_checked_) evaluateBreakpoint(breakpoints_, chip8_, pc, false);
+    break_checked_ = false;
 
     std::cout << "\n" << std::string(60, '=') << "\n";
     std::cout << "🎮 8-bit CHIP-8 Debug State\n";
     std::cout << std::string(60, '=') << "\n";
 
     // 1) PC, Opcode, 해석된 명령어
+    //    (getCurrentOpcode()는 직전에 실행된 명령어이므로, 실행할 명령어를 메모리에서 직접 읽음)
+    opcode = (chip8_.peek_memory(pc) << 8) | chip8_.peek_memory(pc + 1);
     std::cout << "📍 PC=" << toHex16(pc)
-              << "  Opcode=" << toHex32(opcode)
+              << "  Opcode=" << toHex16(static_cast<uint16_t>(opcode))
               << "  ➤ " << disassemble(opcode) << "\n\n";
 
     // 2) V0~V7
@@ -105,33 +379,11 @@ void Debugger8::printState(uint32_t opcode) {
 }
 
 std::string Debugger8::disassemble(uint32_t opcode) {
-    uint16_t opcode16 = static_cast<uint16_t>(opcode & 0xFFFF);
-    
-    std::ostringstream oss;
-    switch (opcode16 & 0xF000) {
-        case 0x0000:
-            if (opcode16 == 0x00E0) oss << "CLS";
-            else if (opcode16 == 0x00EE) oss << "RET";
-            else oss << "SYS";
-            break;
-        case 0x1000: oss << "JP"; break;
-        case 0x2000: oss << "CALL"; break;
-        case 0x3000: oss << "SE"; break;
-        case 0x4000: oss << "SNE"; break;
-        case 0x5000: oss << "SE"; break;
-        case 0x6000: oss << "LD"; break;
-        case 0x7000: oss << "ADD"; break;
-        case 0x8000: oss << "ALU"; break;
-        case 0x9000: oss << "SNE"; break;
-        case 0xA000: oss << "LD I"; break;
-        case 0xB000: oss << "JP V0"; break;
-        case 0xC000: oss << "RND"; break;
-        case 0xD000: oss << "DRW"; break;
-        case 0xE000: oss << "KEY"; break;
-        case 0xF000: oss << "MISC"; break;
-        default: oss << "UNK"; break;
-    }
-    return oss.str();
+    disasm_.set_dialect(chip8_.get_dialect());  // 디버거를 만든 뒤 방언이 바뀐 경우
+    const uint16_t pc = chip8_.get_pc();
+    // XO-CHIP F000 NNNN은 다음 2바이트가 주소 (워치포인트를 거치지 않고 읽음)
+    const uint16_t next = static_cast<uint16_t>((chip8_.peek_memory(pc + 2u) << 8) | chip8_.peek_memory(pc + 3u));
+    return disasm_.at(pc, opcode & 0xFFFF, next);
 }
 
 void Debugger8::handleDebugInput() {
@@ -148,28 +400,30 @@ void Debugger8::handleDebugInput() {
             break; // 다음 명령어 실행
         } else if (input == "c" || input == "continue") {
             step_mode_ = false;
+            resuming_ = true;
+            resume_pc_ = chip8_.get_pc();
             std::cout << "▶️  Continuing execution...\n";
             break;
         } else if (input == "q" || input == "quit") {
             std::cout << "👋 Exiting debugger...\n";
-            enabled_ = false;
+            enable(false);
             break;
-        } else if (input.substr(0, 2) == "bp") {
-            if (input.length() > 3) {
-                try {
-                    uint16_t addr = std::stoi(input.substr(3), nullptr, 16);
-                    addBreakpoint(addr);
-                    std::cout << "📍 Breakpoint set at " << toHex16(addr) << "\n";
-                } catch (...) {
-                    std::cout << "❌ Invalid address format. Use: bp 0x200\n";
-                }
-            }
+        } else if (handleBreakpointCommand(input, breakpoints_, Expression::Isa::Chip8, false)) {
+            // 브레이크포인트 명령 처리 완료
+        } else if (handleWatchCommand(input, chip8_.memory_watch(), false)) {
+            // 워치포인트 명령 처리 완료
         } else if (input == "help" || input == "h") {
             std::cout << "\n🐛 Debug Commands:\n"
                       << "  s, step       - Execute next instruction\n"
                       << "  c, continue   - Continue execution\n"
                       << "  q, quit       - Exit debugger\n"
-                      << "  bp <addr>     - Set breakpoint (hex)\n"
+                      << "  bp <addr> [if <cond>]   - Set (conditional) breakpoint (hex addr)\n"
+                      << "  tp <addr> [if <cond>] [: expr, ...]  - Tracepoint (log and continue)\n"
+                      << "  bd <addr>, bl - Delete / list breakpoints\n"
+                      << "  wp <addr> [len] [=val]  - Write watchpoint (hex addr)\n"
+                      << "  rwp/awp <addr> ...      - Read / access watchpoint\n"
+                      << "  wd <addr>     - Delete watchpoint\n"
+                      << "  wl            - List watchpoints\n"
                       << "  help, h       - Show this help\n\n";
         } else {
             std::cout << "❌ Unknown command. Type 'help' for commands.\n";
@@ -181,6 +435,44 @@ void Debugger8::handleDebugInput() {
 // 32비트 디버거 구현
 // ===============================================
 
+Debugger32::Debugger32(Chip8_32& chip8)
+    : chip8_(chip8), enabled_(false), step_mode_(false), breakpoints_(MEMORY_SIZE_32),
+      disasm_(Isa::Chip8_32, MEMORY_SIZE_32) {}
+
+Debugger32::~Debugger32() {
+    chip8_.set_debug_hook(DebugHook{});
+}
+
+void Debugger32::enable(bool on) {
+    enabled_ = on;
+    // 꺼져 있으면 훅을 떼어 명령어 루프의 검사 비용을 없앰
+    chip8_.set_debug_hook(on ? DebugHook{&breakpoints_.mask(), &Debugger32::breakHook, this} : DebugHook{});
+}
+
+bool Debugger32::breakHook(void* self, uint32_t pc) {
+    return static_cast<Debugger32*>(self)->checkBreak(pc);
+}
+
+// 연속 실행 중 명령어 루프에서 호출 (브레이크포인트 주소이거나 워치포인트 히트가 있을 때만, true = 멈춤)
+bool Debugger32::checkBreak(uint32_t pc) {
+    // 스텝 모드에서는 printState가 명령어마다 같은 검사를 함
+    if (!enabled_ || step_mode_) return false;
+
+    bool stop = reportWatchHits(chip8_.memory_watch(), true);
+
+    // continue 직후에는 방금 멈췄던 브레이크포인트에서 다시 멈추지 않음
+    const bool resumed_here = resuming_ && resume_pc_ == pc;
+    resuming_ = false;
+    if (!resumed_here && evaluateBreakpoint(breakpoints_, chip8_, pc, true)) {
+        stop = true;
+    }
+    if (stop) {
+        step_mode_ = true;
+        break_checked_ = true;
+    }
+    return stop;
+}
+
 std::string Debugger32::toHex8(uint8_t value) const {
     return ::chip8emu::toHex8(value);
 }
@@ -193,21 +485,38 @@ std::string Debugger32::toHex32(uint32_t value) const {
     return ::chip8emu::toHex32(value);
 }
 
+void Debugger32::addWatchpoint(const Watchpoint& wp) {
+    chip8_.memory_watch().add(wp);
+}
+
+bool Debugger32::removeWatchpoint(uint32_t address) {
+    return chip8_.memory_watch().remove(address);
+}
+
+void Debugger32::clearWatchpoints() {
+    chip8_.memory_watch().clear();
+}
+
 void Debugger32::printState(uint32_t opcode) {
-    if (!enabled_) return;
+    // 연속 실행 중에는 명령어 루프의 훅(checkBreak)이 검사하므로 상태 출력 없이 진행
+    if (!enabled_ || !step_mode_) return;
+
+    // 워치포인트 체크 (직전 명령어의 메모리 접근)
+    reportWatchHits(chip8_.memory_watch(), true);
 
-    // 브레이크포인트 체크
+    // 브레이크포인트/트레이스포인트 체크 (훅에서 평가하고 멈춘 경우는 다시 평가하지 않음)
     uint32_t pc = chip8_.get_pc();
-    if (hasBreakpoint(static_cast<uint16_t>(pc))) {
-        std::cout << "\n🚨 BREAKPOINT HIT at " << toHex32(pc) << " 🚨\n";
-        step_mode_ = true;
-    }
+    if (!break_checked_) evaluateBreakpoint(breakpoints_, chip8_, pc, true);
+    break_checked_ = false;
 
     std::cout << "\n" << std::string(60, '=') << "\n";
     std::cout << "🎮 32-bit CHIP-8 Debug State\n";
     std::cout << std::string(60, '=') << "\n";
 
     // 1) PC, Opcode, 해석된 명령어
+    //    (getCurrentOpcode()는 직전에 실행된 명령어이므로, 실행할 명령어를 메모리에서 직접 읽음)
+    opcode = (static_cast<uint32_t>(chip8_.peek_memory(pc)) << 24) | (chip8_.peek_memory(pc + 1) << 16) |
+             (chip8_.peek_memory(pc + 2) << 8) | chip8_.peek_memory(pc + 3);
     std::cout << "📍 PC=" << toHex32(pc)
               << "  Opcode=" << toHex32(opcode)
               << "  ➤ " << disassemble(opcode) << "\n\n";
@@ -256,15 +565,7 @@ void Debugger32::printState(uint32_t opcode) {
 }
 
 std::string Debugger32::disassemble(uint32_t opcode) {
-    uint8_t first = (opcode >> 24) & 0xFF;
-    static const char* kNames[16] = {
-        "SYS", "JP", "CALL", "SE", "SNE", "SE", "LD", "ADD",
-        "ALU", "SNE", "LDI", "JP V0", "RND", "DRW", "KEY", "MISC"
-    };
-    
-    std::ostringstream oss;
-    oss << (first < 0x10 ? kNames[first] : "UNK") << "_32";
-    return oss.str();
+    return disasm_.at(chip8_.get_pc(), opcode);
 }
 
 void Debugger32::handleDebugInput() {
@@ -281,28 +582,30 @@ void Debugger32::handleDebugInput() {
             break; // 다음 명령어 실행
         } else if (input == "c" || input == "continue") {
             step_mode_ = false;
+            resuming_ = true;
+            resume_pc_ = chip8_.get_pc();
             std::cout << "▶️  Continuing execution...\n";
             break;
         } else if (input == "q" || input == "quit") {
             std::cout << "👋 Exiting debugger...\n";
-            enabled_ = false;
+            enable(false);
             break;
-        } else if (input.substr(0, 2) == "bp") {
-            if (input.length() > 3) {
-                try {
-                    uint16_t addr = std::stoi(input.substr(3), nullptr, 16);
-                    addBreakpoint(addr);
-                    std::cout << "📍 Breakpoint set at " << toHex16(addr) << "\n";
-                } catch (...) {
-                    std::cout << "❌ Invalid address format. Use: bp 0x200\n";
-                }
-            }
+        } else if (handleBreakpointCommand(input, breakpoints_, Expression::Isa::Chip8_32, true)) {
+            // 브레이크포인트 명령 처리 완료
+        } else if (handleWatchCommand(input, chip8_.memory_watch(), true)) {
+            // 워치포인트 명령 처리 완료
         } else if (input == "help" || input == "h") {
             std::cout << "\n🐛 Debug Commands:\n"
                       << "  s, step       - Execute next instruction\n"
                       << "  c, continue   - Continue execution\n"
                       << "  q, quit       - Exit debugger\n"
-                      << "  bp <addr>     - Set breakpoint (hex)\n"
+                      << "  bp <addr> [if <cond>]   - Set (conditional) breakpoint (hex addr)\n"
+                      << "  tp <addr> [if <cond>] [: expr, ...]  - Tracepoint (log and continue)\n"
+                      << "  bd <addr>, bl - Delete / list breakpoints\n"
+                      << "  wp <addr> [len] [=val]  - Write watchpoint (hex addr)\n"
+                      << "  rwp/awp <addr> ...      - Read / access watchpoint\n"
+                      << "  wd <addr>     - Delete watchpoint\n"
+                      << "  wl            - List watchpoints\n"
                       << "  help, h       - Show this help\n\n";
         } else {
             std::cout << "❌ Unknown command. Type 'help' for commands.\n";
@@ -0,0 +1,148 @@
+#include "debugger/disassembler.hpp"
+#include "core/opcode_table.hpp"
+#include "core/opcode_table_32.hpp"
+
+namespace chip8emu {
+
+namespace {
+
+const char kHexDigits[] = "0123456789ABCDEF";
+
+// ostringstream 없이 문자열 뒤에 16진수/10진수 덧붙이기
+void appendHex(std::string& out, uint32_t value, int digits) {
+    for (int shift = (digits - 1) * 4; shift >= 0; shift -= 4) {
+        out += kHexDigits[(value >> shift) & 0xF];
+    }
+}
+
+void appendDec(std::string& out, uint32_t value) {
+    char buf[10];
+    int len = 0;
+    do {
+        buf[len++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value);
+    while (len) out += buf[--len];
+}
+
+/// @brief 피연산자 서식 문자열(%x, %y, %n, %b, %k, %a, %p, %l)을 실제 값으로 치환
+/// next는 opcode 다음 2바이트 (%l에서만 사용)
+void appendOperands(std::string& out, Isa isa, const char* operands, uint32_t opcode, uint16_t next) {
+    for (const char* p = operands; *p; ++p) {
+        if (*p != '%' || !p[1]) {
+            out += *p;
+            continue;
+        }
+        char kind = *++p;
+        if (isa == Isa::Chip8) {
+            switch (kind) {
+                case 'x': out += 'V'; appendHex(out, (opcode >> 8) & 0xF, 1); break;
+                case 'y': out += 'V'; appendHex(out, (opcode >> 4) & 0xF, 1); break;
+                case 'n': appendDec(out, opcode & 0xF); break;
+                case 'k': out += "0x"; appendHex(out, opcode & 0xFF, 2); break;
+                case 'a': out += "0x"; appendHex(out, opcode & 0xFFF, 3); break;
+                case 'p': appendDec(out, (opcode >> 8) & 0xF); break;
+                case 'l': out += "0x"; appendHex(out, next, 4); break;
+                default: out += kind; break;
+            }
+        } else {
+            switch (kind) {
+                case 'x': out += 'R'; appendDec(out, (opcode >> 16) & 0xFF); break;
+                case 'y': out += 'R'; appendDec(out, (opcode >> 8) & 0xFF); break;
+                case 'n': appendDec(out, opcode & 0xFF); break;
+                case 'b': out += "0x"; appendHex(out, opcode & 0xFF, 2); break;
+                case 'k': out += "0x"; appendHex(out, opcode & 0xFFFF, 4); break;
+                case 'a': out += "0x"; appendHex(out, opcode & 0xFFFFFF, 6); break;
+                default: out += kind; break;
+            }
+        }
+    }
+}
+
+template <class Info>
+std::string formatWith(const Info* info, Isa isa, uint32_t opcode, uint16_t next = 0) {
+    std::string out;
+    if (!info) {
+        // 정의되지 않은 명령어는 데이터로 표시
+        out = isa == Isa::Chip8 ? "DW 0x" : "DD 0x";
+        appendHex(out, opcode, isa == Isa::Chip8 ? 4 : 8);
+        return out;
+    }
+    out = info->mnemonic;
+    if (*info->operands) {
+        out += ' ';
+        appendOperands(out, isa, info->operands, opcode, next);
+    }
+    return out;
+}
+
+} // namespace
+
+Disassembler::Disassembler(Isa isa, uint32_t address_space, Dialect dialect)
+    : isa_(isa), address_space_(address_space), dialect_(dialect) {}
+
+void Disassembler::set_dialect(Dialect dialect) {
+    if (dialect == dialect_) return;
+    dialect_ = dialect;
+    cache_.clear();
+}
+
+std::string Disassembler::format(Isa isa, uint32_t opcode, Dialect dialect, uint16_t next) {
+    if (isa == Isa::Chip8) {
+        uint16_t opcode16 = static_cast<uint16_t>(opcode);
+        return formatWith(OpcodeTable::Lookup(opcode16, dialect), isa, opcode16, next);
+    }
+    return formatWith(OpcodeTable_32::Lookup(opcode), isa, opcode);
+}
+
+const std::string& Disassembler::at(uint32_t address, uint32_t opcode, uint16_t next) {
+    if (address >= address_space_) {
+        out_of_range_ = format(isa_, opcode, dialect_, next);
+        return out_of_range_;
+    }
+    if (cache_.empty()) cache_.resize(address_space_);
+
+    Entry& entry = cache_[address];
+    if (!entry.valid || entry.opcode != opcode || entry.next != next) {
+        entry.text = format(isa_, opcode, dialect_, next);
+        entry.opcode = opcode;
+        entry.next = next;
+        entry.valid = true;
+    }
+    return entry.text;
+}
+
+void Disassembler::dump(Isa isa, Dialect dialect, const uint8_t* data, std::size_t size, uint32_t base, std::ostream& out) {
+    const uint32_t word = isa == Isa::Chip8 ? 2 : 4;
+    const int addr_digits = isa == Isa::Chip8 ? 4 : 8;
+    std::string line;
+
+    // 마지막 명령어가 잘린 경우 0으로 채움
+    auto read_word = [&](std::size_t offset) {
+        uint32_t value = 0;
+        for (uint32_t i = 0; i < word; ++i) value = (value << 8) | (offset + i < size ? data[offset + i] : 0);
+        return value;
+    };
+
+    for (std::size_t offset = 0; offset < size;) {
+        const uint32_t opcode = read_word(offset);
+        const uint32_t step = instructionSize(isa, dialect, opcode);
+        const uint16_t next = step > word ? static_cast<uint16_t>(read_word(offset + word)) : 0;
+
+        line.clear();
+        appendHex(line, base + static_cast<uint32_t>(offset), addr_digits);
+        line += ": ";
+        appendHex(line, opcode, static_cast<int>(word * 2));
+        if (step > word) {
+            line += ' ';
+            appendHex(line, next, 4);
+        }
+        line += "  ";
+        line += format(isa, opcode, dialect, next);
+        line += '\n';
+        out << line;
+        offset += step;
+    }
+}
+
+} // namespace chip8emu
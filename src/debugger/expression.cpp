@@ -0,0 +1,289 @@
+#include "debugger/expression.hpp"
+#include "core/chip8.hpp"
+#include "core/chip8_32.hpp"
+#include <cctype>
+#include <stdexcept>
+
+namespace chip8emu {
+
+namespace {
+
+// 레지스터 읽기 (코어별 오버로드)
+uint32_t readRegister(const Chip8& chip8, uint32_t index) { return chip8.get_V(index); }
+uint32_t readRegister(const Chip8_32& chip8_32, uint32_t index) { return chip8_32.get_R(index); }
+
+/**
+ * @brief 재귀 하강 파서: 토큰을 읽으면서 곧바로 후위 바이트코드를 생성
+ * 우선순위 (낮음 → 높음): || && | ^ & (== !=) (< <= > >=) (+ -) 단항
+ */
+class Parser {
+public:
+    Parser(const std::string& src, Expression::Isa isa, std::vector<Expression::Instr>& out)
+        : src_(src), isa_(isa), out_(out) {}
+
+    void parse() {
+        parseOr();
+        skipSpace();
+        if (pos_ != src_.size()) fail("unexpected '" + src_.substr(pos_, 1) + "'");
+    }
+
+    std::size_t maxDepth() const { return max_depth_; }
+
+private:
+    using Op = Expression::Op;
+
+    [[noreturn]] void fail(const std::string& msg) {
+        throw std::invalid_argument(msg + " at column " + std::to_string(pos_ + 1));
+    }
+
+    void skipSpace() {
+        while (pos_ < src_.size() && std::isspace(static_cast<unsigned char>(src_[pos_]))) ++pos_;
+    }
+
+    /// @brief 다음 토큰이 tok이면 소비 (단, "&"가 "&&"의 일부인 경우 등은 제외)
+    bool accept(const char* tok) {
+        skipSpace();
+        std::size_t len = std::char_traits<char>::length(tok);
+        if (src_.compare(pos_, len, tok) != 0) return false;
+        if (len == 1 && pos_ + 1 < src_.size()) {
+            char next = src_[pos_ + 1];
+            if ((tok[0] == '&' && next == '&') || (tok[0] == '|' && next == '|') ||
+                ((tok[0] == '<' || tok[0] == '>' || tok[0] == '!') && next == '=')) {
+                return false;
+            }
+        }
+        pos_ += len;
+        return true;
+    }
+
+    void emit(Op op, uint32_t arg = 0) {
+        out_.push_back({op, arg});
+        switch (op) {
+            case Op::PushConst: case Op::PushReg: case Op::PushI: case Op::PushPC:
+            case Op::PushSP: case Op::PushDT: case Op::PushST:
+                ++depth_;
+                break;
+            case Op::LoadMem: case Op::Not: case Op::BitNot: case Op::Neg:
+                break;
+            default:
+                --depth_;  // 이항 연산: 두 개 꺼내고 하나 넣음
+                break;
+        }
+        if (depth_ > max_depth_) max_depth_ = depth_;
+    }
+
+    void parseOr() {
+        parseAnd();
+        while (accept("||")) { parseAnd(); emit(Op::LogicalOr); }
+    }
+
+    void parseAnd() {
+        parseBitOr();
+        while (accept("&&")) { parseBitOr(); emit(Op::LogicalAnd); }
+    }
+
+    void parseBitOr() {
+        parseBitXor();
+        while (accept("|")) { parseBitXor(); emit(Op::Or); }
+    }
+
+    void parseBitXor() {
+        parseBitAnd();
+        while (accept("^")) { parseBitAnd(); emit(Op::Xor); }
+    }
+
+    void parseBitAnd() {
+        parseEquality();
+        while (accept("&")) { parseEquality(); emit(Op::And); }
+    }
+
+    void parseEquality() {
+        parseRelational();
+        while (true) {
+            if (accept("==")) { parseRelational(); emit(Op::Eq); }
+            else if (accept("!=")) { parseRelational(); emit(Op::Ne); }
+            else break;
+        }
+    }
+
+    void parseRelational() {
+        parseAdditive();
+        while (true) {
+            if (accept("<=")) { parseAdditive(); emit(Op::Le); }
+            else if (accept(">=")) { parseAdditive(); emit(Op::Ge); }
+            else if (accept("<")) { parseAdditive(); emit(Op::Lt); }
+            else if (accept(">")) { parseAdditive(); emit(Op::Gt); }
+            else break;
+        }
+    }
+
+    void parseAdditive() {
+        parseUnary();
+        while (true) {
+            if (accept("+")) { parseUnary(); emit(Op::Add); }
+            else if (accept("-")) { parseUnary(); emit(Op::Sub); }
+            else break;
+        }
+    }
+
+    void parseUnary() {
+        if (accept("!")) { parseUnary(); emit(Op::Not); }
+        else if (accept("~")) { parseUnary(); emit(Op::BitNot); }
+        else if (accept("-")) { parseUnary(); emit(Op::Neg); }
+        else parsePrimary();
+    }
+
+    void parsePrimary() {
+        skipSpace();
+        if (accept("(")) {
+            parseOr();
+            if (!accept(")")) fail("expected ')'");
+            return;
+        }
+        if (accept("[")) {
+            parseOr();
+            if (!accept("]")) fail("expected ']'");
+            emit(Op::LoadMem);
+            return;
+        }
+        if (pos_ >= src_.size()) fail("unexpected end of expression");
+
+        char c = src_[pos_];
+        if (std::isdigit(static_cast<unsigned char>(c))) {
+            parseNumber();
+            return;
+        }
+        if (std::isalpha(static_cast<unsigned char>(c))) {
+            std::size_t start = pos_;
+            while (pos_ < src_.size() && std::isalnum(static_cast<unsigned char>(src_[pos_]))) ++pos_;
+            std::string name = src_.substr(start, pos_ - start);
+            for (char& ch : name) ch = static_cast<char>(std::toupper(static_cast<unsigned char>(ch)));
+            emitIdentifier(name);
+            return;
+        }
+        fail("unexpected '" + std::string(1, c) + "'");
+    }
+
+    /// @brief 0x 접두사면 16진수, 아니면 10진수 (0으로 시작해도 8진수로 읽지 않음)
+    void parseNumber() {
+        const bool hex = src_.compare(pos_, 2, "0x") == 0 || src_.compare(pos_, 2, "0X") == 0;
+        if (hex) pos_ += 2;
+        const uint32_t base = hex ? 16 : 10;
+
+        uint64_t value = 0;
+        std::size_t digits = 0;
+        for (; pos_ < src_.size(); ++pos_, ++digits) {
+            const unsigned char ch = static_cast<unsigned char>(src_[pos_]);
+            uint32_t digit;
+            if (std::isdigit(ch)) digit = ch - '0';
+            else if (hex && std::isxdigit(ch)) digit = std::toupper(ch) - 'A' + 10;
+            else break;
+            value = value * base + digit;
+            if (value > 0xFFFFFFFFull) fail("number out of range");
+        }
+        if (digits == 0) fail("invalid number");
+        emit(Op::PushConst, static_cast<uint32_t>(value));
+    }
+
+    void emitIdentifier(const std::string& name) {
+        if (name == "I") { emit(Op::PushI); return; }
+        if (name == "PC") { emit(Op::PushPC); return; }
+        if (name == "SP") { emit(Op::PushSP); return; }
+        if (name == "DT") { emit(Op::PushDT); return; }
+        if (name == "ST") { emit(Op::PushST); return; }
+
+        // V0~VF (16진수 한 자리) 또는 R0~R31 (10진수)
+        if (isa_ == Expression::Isa::Chip8 && name.size() == 2 && name[0] == 'V' &&
+            std::isxdigit(static_cast<unsigned char>(name[1]))) {
+            emit(Op::PushReg, static_cast<uint32_t>(std::stoul(name.substr(1), nullptr, 16)));
+            return;
+        }
+        if (isa_ == Expression::Isa::Chip8_32 && name.size() >= 2 && name.size() <= 3 && name[0] == 'R' &&
+            name.find_first_not_of("0123456789", 1) == std::string::npos) {
+            unsigned long index = std::stoul(name.substr(1));
+            if (index < NUM_REGISTERS_32) {
+                emit(Op::PushReg, static_cast<uint32_t>(index));
+                return;
+            }
+        }
+        pos_ -= name.size();
+        fail("unknown identifier '" + name + "'");
+    }
+
+    const std::string& src_;
+    Expression::Isa isa_;
+    std::vector<Expression::Instr>& out_;
+    std::size_t pos_ = 0;
+    std::size_t depth_ = 0;
+    std::size_t max_depth_ = 0;
+};
+
+} // namespace
+
+std::optional<Expression> Expression::compile(const std::string& source, Isa isa, std::string* error) {
+    Expression expr;
+    expr.source_ = source;
+    try {
+        Parser parser(source, isa, expr.code_);
+        parser.parse();
+        if (parser.maxDepth() > MAX_STACK) throw std::invalid_argument("expression too deep");
+    } catch (const std::invalid_argument& e) {
+        if (error) *error = e.what();
+        return std::nullopt;
+    }
+    return expr;
+}
+
+template <class Core>
+uint32_t Expression::run(const Core& core) const {
+    uint32_t stack[MAX_STACK];
+    std::size_t sp = 0;
+
+    for (const Instr& ins : code_) {
+        switch (ins.op) {
+            case Op::PushConst: stack[sp++] = ins.arg; break;
+            case Op::PushReg:   stack[sp++] = readRegister(core, ins.arg); break;
+            case Op::PushI:     stack[sp++] = core.get_I(); break;
+            case Op::PushPC:    stack[sp++] = core.get_pc(); break;
+            case Op::PushSP:    stack[sp++] = core.get_sp(); break;
+            case Op::PushDT:    stack[sp++] = core.get_delay_timer(); break;
+            case Op::PushST:    stack[sp++] = core.get_sound_timer(); break;
+            case Op::LoadMem:   stack[sp - 1] = core.peek_memory(stack[sp - 1]); break;
+            case Op::Not:       stack[sp - 1] = !stack[sp - 1]; break;
+            case Op::BitNot:    stack[sp - 1] = ~stack[sp - 1]; break;
+            case Op::Neg:       stack[sp - 1] = 0u - stack[sp - 1]; break;
+            default: {
+                uint32_t rhs = stack[--sp];
+                uint32_t& lhs = stack[sp - 1];
+                switch (ins.op) {
+                    case Op::Add:        lhs = lhs + rhs; break;
+                    case Op::Sub:        lhs = lhs - rhs; break;
+                    case Op::And:        lhs = lhs & rhs; break;
+                    case Op::Or:         lhs = lhs | rhs; break;
+                    case Op::Xor:        lhs = lhs ^ rhs; break;
+                    case Op::Eq:         lhs = lhs == rhs; break;
+                    case Op::Ne:         lhs = lhs != rhs; break;
+                    case Op::Lt:         lhs = lhs < rhs; break;
+                    case Op::Le:         lhs = lhs <= rhs; break;
+                    case Op::Gt:         lhs = lhs > rhs; break;
+                    case Op::Ge:         lhs = lhs >= rhs; break;
+                    case Op::LogicalAnd: lhs = (lhs != 0) && (rhs != 0); break;
+                    case Op::LogicalOr:  lhs = (lhs != 0) || (rhs != 0); break;
+                    default: break;
+                }
+                break;
+            }
+        }
+    }
+    return sp ? stack[0] : 0;
+}
+
+uint32_t Expression::evaluate(const Chip8& chip8) const {
+    return run(chip8);
+}
+
+uint32_t Expression::evaluate(const Chip8_32& chip8_32) const {
+    return run(chip8_32);
+}
+
+} // namespace chip8emu
@@ -1,19 +1,48 @@
 #include "mode_selector.hpp"
+#include "common/log_console.hpp"
+#include <cstdlib>
 #include <iostream>
 #include <string>
 
 int main(int argc, char* argv[]) {
+    logging::install_console();
+
     if (argc < 2) {
-        std::cout << "Usage: " << argv[0] << " [--debug] <rom_file>\n";
+        std::cout << "Usage: " << argv[0] << " [--debug] [--disasm] <rom_file>\n";
         std::cout << "Options:\n";
         std::cout << "  --debug    Enable interactive debugger\n";
+        std::cout << "  --disasm   Print ROM disassembly and exit\n";
+        std::cout << "  --log-level <trace|debug|info|warn|error|off>\n";
+        std::cout << "             Runtime log level (levels below the build's CHIP8_LOG_LEVEL are compiled out)\n";
+        std::cout << "  --mute     Disable audio output\n";
+        std::cout << "  --fg <RRGGBB>, --bg <RRGGBB>\n";
+        std::cout << "             Foreground / background colors (default ffffff / 000000)\n";
+        std::cout << "  --turbo    Start in fast-forward mode (toggle with Tab)\n";
+        std::cout << "  --headless Run without window or audio (no SDL), as fast as possible\n";
+        std::cout << "  --frames <n>      Stop after n frames (60 per emulated second)\n";
+        std::cout << "  --capture <file>  Record every frame (.y4m = YUV4MPEG2, otherwise raw RGBA)\n";
+        std::cout << "  --ipf <n>  Instructions executed per 60Hz frame (default: ROM profile, else 10 for 8-bit, 8 for 32-bit)\n";
+        std::cout << "  --keymap <16 keys>\n";
+        std::cout << "             Host keys for keypad 0..F in order (default " << Keymap::DEFAULT << ")\n";
+        std::cout << "  --dialect <chip8|schip|xochip>\n";
+        std::cout << "             Instruction set for 8-bit ROMs (default: detected from ROM)\n";
+        std::cout << "  --mode <8|32>     Force the 8-bit or 32-bit core (default: detected from ROM)\n";
+        std::cout << "  --quirks <none|shift,memory,vfreset,clip,jump>\n";
+        std::cout << "             8-bit behavior variants (default: from ROM profile, else none)\n";
+        std::cout << "  --romdb <file>    ROM profile database (default: romdb.txt next to the ROM)\n";
+        std::cout << "  --romdb-record    Add unknown ROMs to the database with default settings\n";
+        std::cout << "  --log-category <all|cpu8,cpu32,video,...>\n";
+        std::cout << "             Only print log messages from these subsystems\n";
         std::cout << "\nExamples:\n";
         std::cout << "  " << argv[0] << " roms/pong.ch8\n";
         std::cout << "  " << argv[0] << " --debug roms/pong.ch8\n";
+        std::cout << "  " << argv[0] << " roms/pong_og.epa\n";
         return 1;
     }
     
     bool debug_mode = false;
+    bool disasm_mode = false;
+    Palette palette;
     const char* rom_path = nullptr;
     
     // 명령행 인수 파싱
@@ -21,6 +50,84 @@ int main(int argc, char* argv[]) {
         std::string arg = argv[i];
         if (arg == "--debug" || arg == "-d") {
             debug_mode = true;
+        } else if (arg == "--disasm") {
+            disasm_mode = true;
+        } else if (arg == "--headless") {
+            ModeSelector::set_headless(true);
+        } else if (arg == "--frames" && i + 1 < argc) {
+            char* end = nullptr;
+            unsigned long long frames = std::strtoull(argv[++i], &end, 10);
+            if (*end != '\0' || frames == 0) {
+                std::cerr << "Error: Invalid frame count '" << argv[i] << "'\n";
+                return 1;
+            }
+            ModeSelector::set_max_frames(frames);
+        } else if (arg == "--capture" && i + 1 < argc) {
+            ModeSelector::set_capture_path(argv[++i]);
+        } else if (arg == "--turbo") {
+            ModeSelector::set_turbo(true);
+        } else if (arg == "--mute") {
+            ModeSelector::set_audio_enabled(false);
+        } else if ((arg == "--fg" || arg == "--bg") && i + 1 < argc) {
+            uint32_t& color = arg == "--fg" ? palette.foreground() : palette.background();
+            if (!parse_color(argv[++i], color)) {
+                std::cerr << "Error: Invalid color '" << argv[i] << "' (expected RRGGBB)\n";
+                return 1;
+            }
+        } else if (arg == "--ipf" && i + 1 < argc) {
+            char* end = nullptr;
+            unsigned long ipf = std::strtoul(argv[++i], &end, 10);
+            if (*end != '\0' || ipf == 0 || ipf > 1000000) {
+                std::cerr << "Error: Invalid instructions per frame '" << argv[i] << "'\n";
+                return 1;
+            }
+            ModeSelector::set_instructions_per_frame(static_cast<unsigned int>(ipf));
+        } else if (arg == "--keymap" && i + 1 < argc) {
+            Keymap keymap;
+            if (!keymap.parse(argv[++i])) {
+                std::cerr << "Error: Invalid keymap '" << argv[i] << "' (expected 16 distinct keys for 0..F)\n";
+                return 1;
+            }
+            ModeSelector::set_keymap(keymap);
+        } else if (arg == "--log-level" && i + 1 < argc) {
+            logging::Level level;
+            if (!logging::parse_level(argv[++i], level)) {
+                std::cerr << "Error: Unknown log level '" << argv[i] << "'\n";
+                return 1;
+            }
+            logging::set_level(level);
+        } else if (arg == "--dialect" && i + 1 < argc) {
+            Dialect dialect;
+            if (!parse_dialect(argv[++i], dialect)) {
+                std::cerr << "Error: Unknown dialect '" << argv[i] << "'\n";
+                return 1;
+            }
+            ModeSelector::set_dialect(dialect);
+        } else if (arg == "--mode" && i + 1 < argc) {
+            RomKind kind;
+            if (!parse_rom_kind(argv[++i], kind)) {
+                std::cerr << "Error: Unknown mode '" << argv[i] << "' (expected 8 or 32)\n";
+                return 1;
+            }
+            ModeSelector::set_rom_kind(kind);
+        } else if (arg == "--quirks" && i + 1 < argc) {
+            Quirks quirks;
+            if (!parse_quirks(argv[++i], quirks)) {
+                std::cerr << "Error: Unknown quirk in '" << argv[i] << "'\n";
+                return 1;
+            }
+            ModeSelector::set_quirks(quirks);
+        } else if (arg == "--romdb" && i + 1 < argc) {
+            ModeSelector::set_rom_database(argv[++i]);
+        } else if (arg == "--romdb-record") {
+            ModeSelector::set_record_unknown_roms(true);
+        } else if (arg == "--log-category" && i + 1 < argc) {
+            uint32_t mask;
+            if (!logging::parse_categories(argv[++i], mask)) {
+                std::cerr << "Error: Unknown log category in '" << argv[i] << "'\n";
+                return 1;
+            }
+            logging::set_category_mask(mask);
         } else {
             rom_path = argv[i];
         }
@@ -31,8 +138,14 @@ int main(int argc, char* argv[]) {
         return 1;
     }
     
-    // 디버그 모드 설정
+    // 디스어셈블 모드: 실행 없이 ROM 목록만 출력
+    if (disasm_mode) {
+        return ModeSelector::disassemble_rom(rom_path);
+    }
+
+    // 디버그 모드 / 화면 색 설정
     ModeSelector::set_debug_mode(debug_mode);
+    ModeSelector::set_palette(palette);
     
     // 실행
     return ModeSelector::select_and_run(rom_path);
@@ -1,12 +1,20 @@
 #include "platform.hpp"
 #include "chip8_32.hpp"
+#include "timer.hpp"
 #include <SDL2/SDL.h>
 #include <iostream>
 
 Platform::Platform(const char* title, int window_width, int window_height, int texture_width, int texture_height)
     : window_width_(window_width), window_height_(window_height),
       texture_width_(texture_width), texture_height_(texture_height),
-      window_(nullptr), renderer_(nullptr), texture_(nullptr) {}
+      window_(nullptr), renderer_(nullptr), texture_(nullptr) {
+    SetPalette(Palette{});
+}
+
+void Platform::SetPalette(const Palette& palette) {
+    lut_.fill(palette.colors[1]);
+    for (size_t i = 0; i < palette.colors.size(); ++i) lut_[i] = palette.colors[i];
+}
 
 bool Platform::Initialize() {
     // SDL_HINT로 소프트웨어 렌더러 우선
@@ -15,7 +23,7 @@ bool Platform::Initialize() {
     // SDL 초기화
     if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_TIMER) != 0) {
         std::cerr << "[ERROR] SDL_Init failed: " << SDL_GetError() << std::endl;
-        exit(1);
+        return false;
     }
 
     // 환경 변수 출력
@@ -28,7 +36,7 @@ bool Platform::Initialize() {
 
     if (!window_) {
         std::cerr << "[ERROR] SDL_CreateWindow failed: " << SDL_GetError() << std::endl;
-        exit(1);
+        return false;
     }
 
     // 렌더러 생성 (소프트웨어 fallback)
@@ -38,65 +46,91 @@ bool Platform::Initialize() {
         renderer_ = SDL_CreateRenderer(window_, -1, SDL_RENDERER_SOFTWARE);
         if (!renderer_) {
             std::cerr << "[ERROR] SDL_CreateRenderer failed: " << SDL_GetError() << std::endl;
-            exit(1);
+            return false;
         }
     }
 
     // 텍스처 생성
-    texture_ = SDL_CreateTexture(
-        renderer_,
-        SDL_PIXELFORMAT_RGBA8888,
-        SDL_TEXTUREACCESS_STREAMING,
-        texture_width_,
-        texture_height_
-    );
-    if (!texture_) {
-        std::cerr << "[ERROR] SDL_CreateTexture failed: " << SDL_GetError() << std::endl;
-        exit(1);
+    if (!CreateTexture(texture_width_, texture_height_)) {
+        return false;
     }
 
     std::cout << "[INFO] SDL initialization successful\n";
     return true;
 }
 
-bool Platform::ProcessInput(std::array<uint8_t, NUM_KEYS>& keypad) {
+bool Platform::ProcessInput(KeyEventQueue& events, bool& toggle_turbo) {
+    bool quit = false;
     SDL_Event event;
     while (SDL_PollEvent(&event)) {
-        if (event.type == SDL_QUIT) return true;
+        if (event.type == SDL_QUIT) quit = true;
         if (event.type == SDL_KEYDOWN || event.type == SDL_KEYUP) {
-            bool is_pressed = (event.type == SDL_KEYDOWN);
-            switch (event.key.keysym.sym) {
-                case SDLK_1: keypad[0x1] = is_pressed; break;
-                case SDLK_2: keypad[0x2] = is_pressed; break;
-                case SDLK_3: keypad[0x3] = is_pressed; break;
-                case SDLK_4: keypad[0xC] = is_pressed; break;
-                case SDLK_q: keypad[0x4] = is_pressed; break;
-                case SDLK_w: keypad[0x5] = is_pressed; break;
-                case SDLK_e: keypad[0x6] = is_pressed; break;
-                case SDLK_r: keypad[0xD] = is_pressed; break;
-                case SDLK_a: keypad[0x7] = is_pressed; break;
-                case SDLK_s: keypad[0x8] = is_pressed; break;
-                case SDLK_d: keypad[0x9] = is_pressed; break;
-                case SDLK_f: keypad[0xE] = is_pressed; break;
-                case SDLK_z: keypad[0xA] = is_pressed; break;
-                case SDLK_x: keypad[0x0] = is_pressed; break;
-                case SDLK_c: keypad[0xB] = is_pressed; break;
-                case SDLK_v: keypad[0xF] = is_pressed; break;
+            if (event.key.repeat) continue;  // 자동 반복은 상태 변화가 아님
+            if (event.key.keysym.sym == SDLK_TAB) {
+                if (event.type == SDL_KEYDOWN) toggle_turbo = true;
+                continue;
             }
+            int key = keymap_.lookup(event.key.keysym.sym);
+            if (key < 0) continue;
+            // 받은 시각을 함께 넘겨 에뮬레이션 쪽에서 명령어 위치로 배치하게 함
+            // 큐가 가득 차면 (에뮬레이션 스레드가 멈춘 경우) 이벤트를 버림
+            events.try_push({static_cast<uint8_t>(key), event.type == SDL_KEYDOWN, timer::now_ns()});
         }
     }
-    return false;
+    return quit;
+}
+
+void Platform::SetTitle(const char* title) {
+    SDL_SetWindowTitle(window_, title);
+}
+
+int Platform::RefreshRate() const {
+    SDL_DisplayMode mode;
+    if (SDL_GetWindowDisplayMode(window_, &mode) == 0 && mode.refresh_rate > 0) return mode.refresh_rate;
+    return 60;
+}
+
+bool Platform::CreateTexture(int width, int height) {
+    if (texture_) SDL_DestroyTexture(texture_);
+
+    texture_ = SDL_CreateTexture(
+        renderer_,
+        SDL_PIXELFORMAT_RGBA8888,
+        SDL_TEXTUREACCESS_STREAMING,
+        width,
+        height
+    );
+    if (!texture_) {
+        std::cerr << "[ERROR] SDL_CreateTexture failed: " << SDL_GetError() << std::endl;
+        return false;
+    }
+
+    texture_width_ = width;
+    texture_height_ = height;
+    return true;
 }
 
-void Platform::Update(const std::array<uint8_t, VIDEO_WIDTH * VIDEO_HEIGHT>& video, int pitch) {
-    uint32_t pixels[VIDEO_WIDTH * VIDEO_HEIGHT];
-    for (int i = 0; i < VIDEO_WIDTH * VIDEO_HEIGHT; ++i) {
-        pixels[i] = video[i] ? 0xFFFFFFFF : 0x00000000;
+void Platform::Update(const FrameView& frame) {
+    int width = static_cast<int>(frame.width);
+    int height = static_cast<int>(frame.height);
+    if ((width != texture_width_ || height != texture_height_) && !CreateTexture(width, height)) {
+        return;
     }
 
-    // pitch 계산을 여기서 직접 하기
-    int actual_pitch = VIDEO_WIDTH * sizeof(uint32_t);
-    SDL_UpdateTexture(texture_, nullptr, pixels, actual_pitch);
+    // 스트리밍 텍스처에 직접 기록 (중간 버퍼 + SDL_UpdateTexture 복사 없음)
+    void* locked = nullptr;
+    int pitch = 0;
+    if (SDL_LockTexture(texture_, nullptr, &locked, &pitch) != 0) {
+        std::cerr << "[ERROR] SDL_LockTexture failed: " << SDL_GetError() << std::endl;
+        return;
+    }
+    const uint8_t* src = frame.pixels;
+    for (int y = 0; y < height; ++y) {
+        uint32_t* dst = reinterpret_cast<uint32_t*>(static_cast<uint8_t*>(locked) + y * pitch);
+        for (int x = 0; x < width; ++x) dst[x] = lut_[src[x]];
+        src += width;
+    }
+    SDL_UnlockTexture(texture_);
     
     SDL_SetRenderDrawColor(renderer_, 0, 0, 0, 255);
     SDL_RenderClear(renderer_);
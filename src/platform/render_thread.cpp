@@ -0,0 +1,110 @@
+#include "render_thread.hpp"
+#include "platform.hpp"
+#include "timer.hpp"
+#include "common/log.hpp"
+
+#include <chrono>
+#include <cstdio>
+
+RenderThread::RenderThread(const char* title, int window_width, int window_height,
+                           int texture_width, int texture_height, const Palette& palette,
+                           const Keymap& keymap)
+    : title_(title), window_width_(window_width), window_height_(window_height),
+      texture_width_(texture_width), texture_height_(texture_height), palette_(palette),
+      keymap_(keymap) {}
+
+RenderThread::~RenderThread() {
+    stop();
+}
+
+bool RenderThread::start() {
+    running_.store(true, std::memory_order_release);
+    thread_ = std::thread([this] { run(); });
+
+    // Platform 초기화 결과 대기 (시작할 때 한 번뿐이므로 짧게 폴링)
+    while (init_state_.load(std::memory_order_acquire) == 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    if (init_state_.load(std::memory_order_acquire) < 0) {
+        stop();
+        return false;
+    }
+    return true;
+}
+
+void RenderThread::stop() {
+    running_.store(false, std::memory_order_release);
+    if (thread_.joinable()) thread_.join();
+}
+
+void RenderThread::submit(const FrameView& frame) {
+    frames_.write_buffer().assign(frame);
+    frames_.publish();
+}
+
+bool RenderThread::poll_input(InputScheduler& input, uint32_t instructions_per_frame) {
+    input.begin_frame(key_events_, timer::now_ns(), instructions_per_frame);
+    return quit_requested_.load(std::memory_order_relaxed);
+}
+
+void RenderThread::run() {
+    Platform platform(title_.c_str(), window_width_, window_height_, texture_width_, texture_height_);
+    if (!platform.Initialize()) {
+        init_state_.store(-1, std::memory_order_release);
+        return;
+    }
+    platform.SetPalette(palette_);
+    platform.SetKeymap(keymap_);
+    platform.SetTitle(title_.c_str());
+    init_state_.store(1, std::memory_order_release);
+
+    // 주사율당 최대 한 번만 표시 (터보 모드에서 에뮬레이션이 아무리 빨라도)
+    const uint64_t present_interval_ns = timer::NS_PER_SECOND / static_cast<uint64_t>(platform.RefreshRate());
+    uint64_t last_present_ns = 0;
+    speed_window_start_ns_ = timer::now_ns();
+
+    while (running_.load(std::memory_order_acquire)) {
+        bool toggle_turbo = false;
+        if (platform.ProcessInput(key_events_, toggle_turbo)) {
+            quit_requested_.store(true, std::memory_order_relaxed);
+        }
+        if (toggle_turbo) {
+            bool enable = !turbo();
+            set_turbo(enable);
+            LOG_INFO(Platform, "Turbo %s", enable ? "on" : "off");
+        }
+
+        uint64_t now = timer::now_ns();
+        update_title(platform, now);
+
+        if (now - last_present_ns >= present_interval_ns && frames_.update()) {
+            platform.Update(frames_.read_buffer().view());
+            presented_.fetch_add(1, std::memory_order_relaxed);
+            last_present_ns = now;
+        } else {
+            // 새 프레임이 없으면 잠깐 쉼 (입력 지연 최대 1ms)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+}
+
+// 1초마다 에뮬레이션 프레임 수로 배속 계산 (60 프레임/초 = 1.0x), 터보일 때만 제목에 표시
+void RenderThread::update_title(Platform& platform, uint64_t now_ns) {
+    if (now_ns - speed_window_start_ns_ < timer::NS_PER_SECOND) return;
+
+    uint64_t frames = emulated_.load(std::memory_order_relaxed);
+    double seconds = static_cast<double>(now_ns - speed_window_start_ns_) / timer::NS_PER_SECOND;
+    double speed = static_cast<double>(frames - speed_window_frames_) / (seconds * FRAME_RATE);
+    speed_window_start_ns_ = now_ns;
+    speed_window_frames_ = frames;
+
+    if (turbo()) {
+        char title[160];
+        std::snprintf(title, sizeof(title), "%s [TURBO %.1fx]", title_.c_str(), speed);
+        platform.SetTitle(title);
+        title_shows_speed_ = true;
+    } else if (title_shows_speed_) {
+        platform.SetTitle(title_.c_str());
+        title_shows_speed_ = false;
+    }
+}
@@ -0,0 +1,52 @@
+#include "sdl_audio.hpp"
+#include "common/log.hpp"
+
+#include <cstring>
+
+SdlAudioSink::~SdlAudioSink() {
+    if (device_) {
+        SDL_CloseAudioDevice(device_);
+        SDL_QuitSubSystem(SDL_INIT_AUDIO);
+    }
+}
+
+bool SdlAudioSink::open(unsigned int sample_rate) {
+    if (SDL_InitSubSystem(SDL_INIT_AUDIO) != 0) {
+        LOG_WARN(Platform, "SDL audio init failed: %s", SDL_GetError());
+        return false;
+    }
+
+    SDL_AudioSpec want;
+    SDL_AudioSpec have;
+    SDL_zero(want);
+    want.freq = static_cast<int>(sample_rate);
+    want.format = AUDIO_S16SYS;
+    want.channels = 1;
+    want.samples = 512;            // 콜백 한 번에 약 11ms (44.1kHz 기준)
+    want.callback = &SdlAudioSink::callback;
+    want.userdata = this;
+
+    device_ = SDL_OpenAudioDevice(nullptr, 0, &want, &have, SDL_AUDIO_ALLOW_FREQUENCY_CHANGE);
+    if (!device_) {
+        LOG_WARN(Platform, "SDL_OpenAudioDevice failed: %s", SDL_GetError());
+        SDL_QuitSubSystem(SDL_INIT_AUDIO);
+        return false;
+    }
+
+    sample_rate_ = static_cast<unsigned int>(have.freq);
+    SDL_PauseAudioDevice(device_, 0);
+    LOG_INFO(Platform, "Audio: %u Hz mono, %u-sample buffer", sample_rate_, static_cast<unsigned int>(have.samples));
+    return true;
+}
+
+void SdlAudioSink::callback(void* userdata, Uint8* stream, int len) {
+    auto* self = static_cast<SdlAudioSink*>(userdata);
+    auto* out = reinterpret_cast<int16_t*>(stream);
+    std::size_t wanted = static_cast<std::size_t>(len) / sizeof(int16_t);
+
+    std::size_t got = self->ring_.pop(out, wanted);
+    if (got < wanted) {
+        std::memset(out + got, 0, (wanted - got) * sizeof(int16_t));
+        self->underruns_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
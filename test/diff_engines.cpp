@@ -0,0 +1,848 @@
+#include "core/chip8.hpp"
+#include "core/chip8_32.hpp"
+#include "core/machine.hpp"
+#include "core/opcode_table.hpp"
+#include "core/opcode_table_32.hpp"
+#include "core/rom_detect.hpp"
+#include "core/rom_db.hpp"
+#include "common/input.hpp"
+#include "common/rng.hpp"
+#include "debugger/disassembler.hpp"
+#include "timer.hpp"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <dirent.h>
+#include <exception>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @file diff_engines.cpp
+ * @brief 두 실행 엔진을 같은 프로그램으로 나란히 돌려 머신 상태를 비교하는 차분 테스트
+ *
+ * 사용법: diff_engines [옵션]
+ *   --isa 8|32|all        비교할 ISA (기본 all)
+ *   --engines A,B         비교할 엔진 두 개 (기본 interpreter,batched)
+ *   --random N            ISA마다 무작위 명령어 N개 이상 실행 (기본 2000000, 0이면 건너뜀)
+ *   --seed S              무작위 프로그램 생성 시드 (ROM 실행 시에는 코어 난수와 키 입력 시드)
+ *   --program S           시드 S로 만든 무작위 프로그램 하나만 실행 (보고서의 재현 명령)
+ *   --block N             상태를 비교할 명령어 묶음 크기 (기본 256)
+ *   --rom <파일>          ROM 하나를 --steps개 명령어만큼 실행 (--dialect, --quirks 적용)
+ *   --roms <디렉토리>     디렉토리의 모든 ROM 실행
+ *   --steps N             ROM당 실행할 명령어 수 (기본 200000)
+ *   --repro <파일>        줄인 재현 프로그램을 ROM 파일로 저장
+ *   --self-test           일부러 틀린 엔진(faulty)으로 불일치 검출과 재현 축소가 동작하는지 확인
+ *
+ * 엔진은 "명령어를 최대 count개 실행"하는 함수이며, 묶음마다 두 엔진의 전체 상태
+ * (레지스터, 스택, 타이머, 메모리, 화면, 키패드, 코어 고유 상태)를 비교한다.
+ * 키 입력은 시드로 정해지는 명령어 번호별 눌림/뗌 목록이며, 기준 엔진은 명령어 직전에 직접 반영하고
+ * batched 엔진은 호스트와 같이 KeyEventQueue → InputScheduler → CoreMachine::run_batch로 반영한다.
+ * 다르면 묶음 시작 스냅샷으로 되돌려 한 명령어씩 다시 실행해 처음 달라진 명령어를 찾고,
+ * 불일치가 유지되는 동안 프로그램의 명령어를 NOP으로 바꿔 최소 재현 프로그램으로 줄인다.
+ * 새 실행 엔진(미리 디코드, JIT 등)은 engines()에 추가하면 같은 검사를 받는다.
+ */
+
+namespace {
+
+using chip8emu::Disassembler;
+using chip8emu::Isa;
+
+constexpr uint32_t DIFF_SEED = 0xC0FFEE;
+constexpr unsigned int DEFAULT_BLOCK = 256;
+constexpr uint64_t DEFAULT_RANDOM = 2000000;
+constexpr uint64_t DEFAULT_ROM_STEPS = 200000;
+constexpr unsigned int PROGRAM_WORDS = 128;      // 무작위 프로그램 길이 (명령어 수)
+constexpr uint64_t PROGRAM_STEPS = 1024;         // 무작위 프로그램 하나의 최대 실행 명령어 수
+constexpr uint64_t SELF_TEST_RANDOM = DEFAULT_RANDOM;  // 결함을 찾으면 바로 멈추므로 상한일 뿐
+
+// 키 입력 간격 (명령어 수)과 batched 엔진의 run_batch 한 번 길이
+constexpr unsigned int KEY_GAP_MIN = 16;
+constexpr unsigned int KEY_GAP_MAX = 112;
+constexpr unsigned int BATCH_SIZE = 512;
+constexpr uint64_t NS_PER_INSTRUCTION = 1000;   // 큐 이벤트 시각을 명령어 번호에 비례하게 찍는 간격
+static_assert(BATCH_SIZE / KEY_GAP_MIN < InputScheduler::MAX_EVENTS_PER_FRAME, "key events per batch must fit");
+static_assert(BATCH_SIZE / KEY_GAP_MIN < KeyEventQueue::capacity(), "key events per batch must fit");
+
+/// @brief 명령어 번호 instruction을 실행하기 직전에 반영할 키 변화
+struct KeyStep {
+    uint64_t instruction;
+    uint8_t key;
+    bool pressed;
+};
+
+/**
+ * @brief 시드로 정해지는 키 입력 목록 (steps 미만의 명령어 번호)
+ * 앞에서부터 차례로 만들므로 steps가 달라도 겹치는 구간은 같다 (줄인 재현 프로그램도 같은 입력을 받음).
+ */
+std::vector<KeyStep> key_schedule(uint32_t seed, uint64_t steps) {
+    Xorshift32 rng(seed ^ 0x4B45590Au);
+    std::vector<KeyStep> keys;
+    std::array<bool, NUM_KEYS> held{};
+    for (uint64_t at = rng.next() % KEY_GAP_MAX; at < steps; at += KEY_GAP_MIN + rng.next() % (KEY_GAP_MAX - KEY_GAP_MIN)) {
+        const uint8_t key = static_cast<uint8_t>(rng.next() % NUM_KEYS);
+        held[key] = !held[key];
+        keys.push_back({at, key, held[key]});
+    }
+    return keys;
+}
+
+/// @brief 엔진 호출 한 번이 맡는 구간 [first, first + count)의 키 입력
+struct KeyWindow {
+    const std::vector<KeyStep>& keys;
+    uint64_t first;
+    unsigned int count;
+
+    // 구간 안의 첫 이벤트 / 구간 끝 다음 이벤트 위치
+    std::size_t begin() const { return position(first); }
+    std::size_t end() const { return position(first + count); }
+
+    std::size_t position(uint64_t instruction) const {
+        return std::lower_bound(keys.begin(), keys.end(), instruction,
+                                [](const KeyStep& step, uint64_t at) { return step.instruction < at; }) - keys.begin();
+    }
+};
+
+/// @brief 실행 엔진: 명령어를 최대 count개 실행하고 실제 실행한 수를 돌려줌 (구간의 키 입력은 모두 반영)
+template <typename Core>
+struct Engine {
+    const char* name;
+    unsigned int (*run)(CoreMachine<Core>& machine, const KeyWindow& keys);
+};
+
+/**
+ * @brief 기준 엔진: 명령어마다 키 입력을 직접 반영하고 cycle() 한 번
+ * 도중에 멈추면 호스트와 같이 구간의 남은 입력을 모두 반영한다.
+ * after는 명령어마다 실행 뒤에 부를 함수 (faulty 엔진의 결함 주입용, 없으면 nullptr)
+ */
+template <typename Core>
+unsigned int run_stepped(CoreMachine<Core>& machine, const KeyWindow& keys, void (*after)(Core&)) {
+    Core& core = machine.core();
+    std::size_t next = keys.begin();
+    const std::size_t end = keys.end();
+    unsigned int executed = 0;
+    for (; executed < keys.count && !core.is_halted(); ++executed) {
+        for (; next < end && keys.keys[next].instruction <= keys.first + executed; ++next) {
+            core.keypad[keys.keys[next].key] = keys.keys[next].pressed;
+        }
+        core.cycle();
+        if (after) after(core);
+    }
+    for (; next < end; ++next) core.keypad[keys.keys[next].key] = keys.keys[next].pressed;
+    return executed;
+}
+
+template <typename Core>
+unsigned int run_interpreter(CoreMachine<Core>& machine, const KeyWindow& keys) {
+    return run_stepped<Core>(machine, keys, nullptr);
+}
+
+/**
+ * @brief 호스트 루프와 같은 경로: 키 이벤트를 KeyEventQueue에 넣고 InputScheduler::begin_frame으로
+ * 명령어 위치에 배치한 뒤 CoreMachine::run_batch로 실행 (이벤트 시각을 명령어 번호에 비례하게 찍음)
+ */
+template <typename Core>
+unsigned int run_batched(CoreMachine<Core>& machine, const KeyWindow& keys) {
+    std::size_t next = keys.begin();
+    const std::size_t end = keys.end();
+    unsigned int executed = 0;
+    for (unsigned int offset = 0; offset < keys.count; offset += BATCH_SIZE) {
+        const unsigned int count = std::min(BATCH_SIZE, keys.count - offset);
+        const uint64_t first = keys.first + offset;
+        const uint64_t start_ns = NS_PER_INSTRUCTION;
+
+        KeyEventQueue queue;
+        InputScheduler input;
+        input.begin_frame(queue, start_ns, count);   // 구간 시작 시각만 기록
+        for (; next < end && keys.keys[next].instruction < first + count; ++next) {
+            const KeyStep& step = keys.keys[next];
+            queue.try_push({step.key, step.pressed, start_ns + (step.instruction - first) * NS_PER_INSTRUCTION});
+        }
+        input.begin_frame(queue, start_ns + count * NS_PER_INSTRUCTION, count);
+        // 멈춘 코어는 0개를 실행하고 남은 입력만 반영
+        executed += machine.run_batch(count, input);
+    }
+    return executed;
+}
+
+// 하네스 자체 검사용으로 일부러 틀린 엔진: ADD 뒤에 결과를 한 비트 뒤집음
+void inject_fault(Chip8& core) {
+    if ((core.getCurrentOpcode() & 0xF00F) == 0x8004) core.set_V(0xF, core.get_V(0xF) ^ 1);  // ADD Vx, Vy
+}
+
+void inject_fault(Chip8_32& core) {
+    if ((core.getCurrentOpcode() >> 24) == 0x07) core.set_R(0, core.get_R(0) ^ 1);  // ADD Rx, kk
+}
+
+template <typename Core>
+unsigned int run_faulty(CoreMachine<Core>& machine, const KeyWindow& keys) {
+    return run_stepped<Core>(machine, keys, inject_fault);
+}
+
+template <typename Core>
+std::vector<Engine<Core>> engines() {
+    return {{"interpreter", run_interpreter<Core>},
+            {"batched", run_batched<Core>},
+            {"faulty", run_faulty<Core>}};
+}
+
+template <typename Core>
+const Engine<Core>* find_engine(const std::string& name) {
+    static const std::vector<Engine<Core>> all = engines<Core>();
+    for (const Engine<Core>& engine : all) {
+        if (name == engine.name) return &engine;
+    }
+    return nullptr;
+}
+
+/// @brief 실행할 프로그램과 코어 설정 (무작위 프로그램, ROM, 재현 프로그램 공통)
+struct Case {
+    std::vector<uint8_t> program;
+    Dialect dialect = Dialect::Chip8;   // 8비트 전용
+    Quirks quirks;                      // 8비트 전용
+    uint32_t seed = DIFF_SEED;          // 코어 난수 시드
+    uint64_t steps = 0;                 // 최대 실행 명령어 수
+};
+
+/// @brief 처음 달라진 명령어
+struct Divergence {
+    bool found = false;
+    uint64_t index = 0;       // 실행 순서 (0부터)
+    uint32_t pc = 0;          // 실행 전 PC
+    uint32_t opcode = 0;      // 기준 엔진이 실행한 명령어
+    std::string what;         // 처음 달라진 상태 필드
+};
+
+uint32_t read_word(const std::vector<uint8_t>& program, std::size_t offset, unsigned int size) {
+    uint32_t value = 0;
+    for (unsigned int i = 0; i < size; ++i) value = (value << 8) | program[offset + i];
+    return value;
+}
+
+void write_word(std::vector<uint8_t>& program, std::size_t offset, unsigned int size, uint32_t value) {
+    for (unsigned int i = 0; i < size; ++i) program[offset + i] = static_cast<uint8_t>(value >> (8 * (size - 1 - i)));
+}
+
+// 분기/I 대상은 무작위 프로그램 안의 명령어 경계로 제한
+uint32_t random_target(Xorshift32& rng, unsigned int size) {
+    return PROGRAM_START + (rng.next() % PROGRAM_WORDS) * size;
+}
+
+Quirks quirks_from_mask(unsigned int mask) {
+    Quirks quirks;
+    quirks.shift_vy = (mask & QUIRK_SHIFT) != 0;
+    quirks.memory_i = (mask & QUIRK_MEMORY) != 0;
+    quirks.vf_reset = (mask & QUIRK_VF_RESET) != 0;
+    quirks.clip = (mask & QUIRK_CLIP) != 0;
+    quirks.jump_vx = (mask & QUIRK_JUMP) != 0;
+    return quirks;
+}
+
+std::string hex(uint32_t value) {
+    char text[16];
+    std::snprintf(text, sizeof(text), "0x%X", value);
+    return text;
+}
+
+/// @brief ISA별 차이: 명령어 생성, NOP, 코어 설정, 출력 형식
+template <typename Core>
+struct IsaInfo;
+
+template <>
+struct IsaInfo<Chip8> {
+    static constexpr Isa ISA = Isa::Chip8;
+    static constexpr const char* NAME = "8-bit";
+    static constexpr const char* FLAG = "8";
+    static constexpr uint32_t NOP = 0x8000;   // LD V0, V0
+    static constexpr int DIGITS = 4;
+
+    // 명령어 정의 하나를 골라 나머지 비트를 무작위로 채움 (모든 방언의 명령어를 섞음)
+    static uint32_t random_opcode(Xorshift32& rng) {
+        const auto& definitions = OpcodeTable::Definitions();
+        const auto& info = definitions[rng.next() % definitions.size()];
+        uint32_t opcode = (info.pattern | (rng.next() & ~info.mask)) & 0xFFFF;
+        if (std::strstr(info.operands, "%a")) opcode = (opcode & 0xF000) | random_target(rng, 2);
+        return opcode;
+    }
+
+    static Case random_case(uint32_t seed) {
+        Xorshift32 rng(seed);
+        Case c;
+        c.seed = seed;
+        c.steps = PROGRAM_STEPS;
+        c.dialect = static_cast<Dialect>(rng.next() % NUM_DIALECTS);
+        c.quirks = quirks_from_mask(rng.next() % NUM_QUIRK_SETS);
+        c.program.resize(PROGRAM_WORDS * 2);
+        for (unsigned int i = 0; i < PROGRAM_WORDS; ++i) write_word(c.program, i * 2, 2, random_opcode(rng));
+        return c;
+    }
+
+    static bool prepare(Chip8& core, const Case& c) {
+        core.set_seed(c.seed);
+        core.set_dialect(c.dialect);
+        core.set_quirks(c.quirks);
+        return core.load_rom_data(c.program.data(), c.program.size()) == RomError::None;
+    }
+
+    static std::string describe(const Case& c) {
+        return std::string("--dialect ") + dialect_key(c.dialect) + " --quirks " + quirks_name(c.quirks);
+    }
+
+    static std::string register_name(unsigned int index) {
+        return "V" + std::string(1, "0123456789ABCDEF"[index & 0xF]);
+    }
+
+    // 코어 고유 상태: XO-CHIP 평면, RPL 플래그, 오디오
+    static bool extra_differs(std::string& out, const Chip8& a, const Chip8& b);
+};
+
+template <>
+struct IsaInfo<Chip8_32> {
+    static constexpr Isa ISA = Isa::Chip8_32;
+    static constexpr const char* NAME = "32-bit";
+    static constexpr const char* FLAG = "32";
+    static constexpr uint32_t NOP = 0x08000000;   // LD R0, R0
+    static constexpr int DIGITS = 8;
+
+    // 레지스터 번호는 R0~R31, 분기/I 대상은 프로그램 안으로 제한
+    static uint32_t random_opcode(Xorshift32& rng) {
+        const auto& definitions = OpcodeTable_32::Definitions();
+        const auto& info = definitions[rng.next() % definitions.size()];
+        uint32_t opcode = info.pattern | (rng.next() & ~info.mask);
+        if (std::strstr(info.operands, "%a")) opcode = (opcode & 0xFF000000) | random_target(rng, 4);
+        if (std::strstr(info.operands, "%x")) opcode = (opcode & ~0x00FF0000u) | ((rng.next() % Chip8_32::REGISTER_COUNT) << 16);
+        if (std::strstr(info.operands, "%y")) opcode = (opcode & ~0x0000FF00u) | ((rng.next() % Chip8_32::REGISTER_COUNT) << 8);
+        return opcode;
+    }
+
+    static Case random_case(uint32_t seed) {
+        Xorshift32 rng(seed);
+        Case c;
+        c.seed = seed;
+        c.steps = PROGRAM_STEPS;
+        c.program.resize(PROGRAM_WORDS * 4);
+        for (unsigned int i = 0; i < PROGRAM_WORDS; ++i) write_word(c.program, i * 4, 4, random_opcode(rng));
+        return c;
+    }
+
+    static bool prepare(Chip8_32& core, const Case& c) {
+        core.set_seed(c.seed);
+        core.reset();
+        return core.load_rom_data(c.program.data(), c.program.size()) == RomError::None;
+    }
+
+    static std::string describe(const Case&) { return ""; }
+
+    static std::string register_name(unsigned int index) { return "R" + std::to_string(index); }
+
+    static bool extra_differs(std::string& out, const Chip8_32& a, const Chip8_32& b);
+};
+
+// 두 값이 다르면 "필드: A vs B"를 남기고 true
+template <typename T>
+bool differs(std::string& out, const std::string& field, T a, T b) {
+    if (a == b) return false;
+    out = field + ": " + hex(static_cast<uint32_t>(a)) + " vs " + hex(static_cast<uint32_t>(b));
+    return true;
+}
+
+bool buffer_differs(std::string& out, const char* field, const uint8_t* a, const uint8_t* b, std::size_t size) {
+    if (std::memcmp(a, b, size) == 0) return false;
+    std::size_t i = 0;
+    while (a[i] == b[i]) ++i;
+    out = std::string(field) + "[" + hex(static_cast<uint32_t>(i)) + "]: " + hex(a[i]) + " vs " + hex(b[i]);
+    return true;
+}
+
+bool IsaInfo<Chip8>::extra_differs(std::string& out, const Chip8& a, const Chip8& b) {
+    if (differs(out, "planes", a.get_planes(), b.get_planes()) ||
+        differs(out, "audio pitch", a.get_audio_pitch(), b.get_audio_pitch())) {
+        return true;
+    }
+    for (int i = 0; i < static_cast<int>(NUM_RPL_FLAGS); ++i) {
+        if (differs(out, "RPL" + std::to_string(i), a.get_rpl(i), b.get_rpl(i))) return true;
+    }
+    return buffer_differs(out, "audio pattern", a.get_audio_pattern().data(), b.get_audio_pattern().data(),
+                          AUDIO_PATTERN_SIZE);
+}
+
+bool IsaInfo<Chip8_32>::extra_differs(std::string& out, const Chip8_32& a, const Chip8_32& b) {
+    return differs(out, "video mode", static_cast<uint32_t>(a.get_video_mode()), static_cast<uint32_t>(b.get_video_mode()));
+}
+
+/// @brief 두 코어의 전체 상태를 비교해 처음 다른 필드를 설명 (같으면 빈 문자열)
+template <typename Core>
+std::string first_difference(const Core& a, const Core& b) {
+    std::string out;
+    if (differs(out, "PC", a.get_pc(), b.get_pc()) || differs(out, "I", a.get_I(), b.get_I()) ||
+        differs(out, "SP", a.get_sp(), b.get_sp()) || differs(out, "halted", a.is_halted(), b.is_halted()) ||
+        differs(out, "DT", a.delay_timer, b.delay_timer) || differs(out, "ST", a.sound_timer, b.sound_timer) ||
+        differs(out, "draw flag", a.draw_flag, b.draw_flag) ||
+        differs(out, "memory size", a.memory_size(), b.memory_size()) ||
+        differs(out, "video width", a.video_width(), b.video_width()) ||
+        differs(out, "video height", a.video_height(), b.video_height())) {
+        return out;
+    }
+    for (unsigned int i = 0; i < Core::REGISTER_COUNT; ++i) {
+        if (differs(out, IsaInfo<Core>::register_name(i), a.get_register(i), b.get_register(i))) return out;
+    }
+    for (unsigned int i = 0; i < Core::STACK_DEPTH; ++i) {
+        if (differs(out, "stack[" + std::to_string(i) + "]", a.get_stack(i), b.get_stack(i))) return out;
+    }
+    if (buffer_differs(out, "memory", a.memory_data(), b.memory_data(), a.memory_size()) ||
+        buffer_differs(out, "video", a.video.data(), b.video.data(), a.video.size()) ||
+        buffer_differs(out, "keypad", a.keypad.data(), b.keypad.data(), a.keypad.size()) ||
+        IsaInfo<Core>::extra_differs(out, a, b)) {
+        return out;
+    }
+    return out;
+}
+
+// 엔진 실행 (예외는 두 엔진이 같아야 하는 상태의 일부로 보고 코어를 멈춤)
+template <typename Core>
+unsigned int step(const Engine<Core>& engine, CoreMachine<Core>& machine, const KeyWindow& keys) {
+    try {
+        return engine.run(machine, keys);
+    } catch (const std::exception&) {
+        machine.halt();
+        return 0;
+    }
+}
+
+/**
+ * @brief 두 엔진을 block개씩 나란히 실행하며 묶음마다 상태를 비교 (묶음 사이에 타이머 감소)
+ * @param executed 기준 엔진이 실제 실행한 명령어 수를 더함 (nullptr 가능)
+ */
+template <typename Core>
+Divergence lockstep(const Engine<Core>& first, const Engine<Core>& second, const Case& c, unsigned int block,
+                    uint64_t* executed = nullptr) {
+    // 코어는 메모리/화면 배열을 통째로 들고 있어 힙에 한 번만 만들고 프로그램마다 prepare로 초기화
+    using Slot = std::unique_ptr<CoreMachine<Core>>;
+    static const Slot a = std::make_unique<CoreMachine<Core>>(IsaInfo<Core>::NAME);
+    static const Slot b = std::make_unique<CoreMachine<Core>>(IsaInfo<Core>::NAME);
+    static const Slot a_start = std::make_unique<CoreMachine<Core>>(IsaInfo<Core>::NAME);
+    static const Slot b_start = std::make_unique<CoreMachine<Core>>(IsaInfo<Core>::NAME);
+
+    Divergence result;
+    if (!IsaInfo<Core>::prepare(a->core(), c) || !IsaInfo<Core>::prepare(b->core(), c)) {
+        result.found = true;
+        result.what = "cannot load program";
+        return result;
+    }
+    const std::vector<KeyStep> keys = key_schedule(c.seed, c.steps);
+
+    uint64_t done = 0;
+    while (done < c.steps && !(a->is_halted() && b->is_halted())) {
+        const unsigned int count = static_cast<unsigned int>(std::min<uint64_t>(block, c.steps - done));
+        *a_start = *a;
+        *b_start = *b;
+        const unsigned int ran = step(first, *a, KeyWindow{keys, done, count});
+        step(second, *b, KeyWindow{keys, done, count});
+        if (executed) *executed += ran;
+
+        if (!first_difference(a->core(), b->core()).empty()) {
+            // 묶음 시작으로 되돌려 한 명령어씩 다시 실행하며 처음 달라진 명령어를 찾음
+            a->restore(*a_start);
+            b->restore(*b_start);
+            for (unsigned int i = 0; i < count; ++i) {
+                const uint32_t pc = a->core().get_pc();
+                step(first, *a, KeyWindow{keys, done + i, 1});
+                step(second, *b, KeyWindow{keys, done + i, 1});
+                result.what = first_difference(a->core(), b->core());
+                if (!result.what.empty()) {
+                    result.found = true;
+                    result.index = done + i;
+                    result.pc = pc;
+                    result.opcode = a->current_opcode();
+                    return result;
+                }
+            }
+            // 한 명령어씩은 같은데 묶음으로는 다름 (엔진이 묶음 경계에 따라 다르게 동작)
+            result.found = true;
+            result.index = done + count - 1;
+            result.pc = a_start->core().get_pc();
+            result.what = "block of " + std::to_string(count) + " differs, single steps agree";
+            return result;
+        }
+
+        a->tick_timers();
+        b->tick_timers();
+        done += count;
+    }
+    return result;
+}
+
+template <typename Core>
+bool is_nop(const std::vector<uint8_t>& program, std::size_t offset) {
+    return read_word(program, offset, Core::INSTRUCTION_SIZE) == IsaInfo<Core>::NOP;
+}
+
+/**
+ * @brief 불일치가 남아 있는 동안 명령어를 하나씩 NOP으로 바꾸고 뒤쪽 NOP을 잘라 재현 프로그램을 줄임
+ * 분기를 NOP으로 바꾸면 NOP을 타고 내려가야 하므로, 시도마다 프로그램 길이만큼 더 실행해 본다.
+ * 결과의 실행 길이는 처음 달라진 명령어까지다.
+ */
+template <typename Core>
+Case reduce(const Engine<Core>& first, const Engine<Core>& second, Case c, const Divergence& divergence,
+            unsigned int block) {
+    const unsigned int size = Core::INSTRUCTION_SIZE;
+    const uint64_t slack = c.program.size() / size;
+    uint64_t index = divergence.index;
+
+    auto attempt = [&](Case trial) {
+        trial.steps = index + 1 + slack;
+        const Divergence d = lockstep(first, second, trial, block);
+        if (!d.found) return false;
+        c = trial;
+        index = d.index;
+        return true;
+    };
+
+    // 앞쪽 분기는 뒤쪽 명령어가 NOP이 된 뒤에야 지울 수 있으므로 더 줄지 않을 때까지 반복
+    for (bool changed = true; changed;) {
+        changed = false;
+        for (std::size_t offset = 0; offset + size <= c.program.size(); offset += size) {
+            if (is_nop<Core>(c.program, offset)) continue;
+            Case trial = c;
+            write_word(trial.program, offset, size, IsaInfo<Core>::NOP);
+            changed |= attempt(trial);
+        }
+    }
+
+    while (c.program.size() > size && is_nop<Core>(c.program, c.program.size() - size)) {
+        Case trial = c;
+        trial.program.resize(c.program.size() - size);
+        if (!attempt(trial)) break;
+    }
+    c.steps = index + 1;
+    return c;
+}
+
+struct Options {
+    std::string engines = "interpreter,batched";
+    uint64_t random = DEFAULT_RANDOM;
+    uint32_t seed = DIFF_SEED;
+    bool single_program = false;
+    uint32_t program_seed = 0;
+    unsigned int block = DEFAULT_BLOCK;
+    uint64_t steps = DEFAULT_ROM_STEPS;
+    bool has_dialect = false;
+    Dialect dialect = Dialect::Chip8;
+    Quirks quirks;
+    std::string repro;
+};
+
+template <typename Core>
+void report(const Engine<Core>& first, const Engine<Core>& second, const std::string& label, const Case& original,
+            const Divergence& divergence, const Case& reduced, const Options& options) {
+    using Info = IsaInfo<Core>;
+    const unsigned int size = Core::INSTRUCTION_SIZE;
+
+    std::printf("[DIFF] %s: %s vs %s diverge at instruction %" PRIu64 "\n",
+                label.c_str(), first.name, second.name, divergence.index);
+    std::printf("       PC=0x%04X  %0*X  %s\n", divergence.pc, Info::DIGITS, divergence.opcode,
+                Disassembler::format(Info::ISA, divergence.opcode).c_str());
+    std::printf("       first difference (%s vs %s): %s\n", first.name, second.name, divergence.what.c_str());
+
+    std::size_t kept = 0;
+    for (std::size_t offset = 0; offset + size <= reduced.program.size(); offset += size) {
+        if (!is_nop<Core>(reduced.program, offset)) ++kept;
+    }
+    std::printf("       reproducer: %zu of %zu instructions, %" PRIu64 " steps (other words are %s)\n",
+                kept, original.program.size() / size, reduced.steps,
+                Disassembler::format(Info::ISA, Info::NOP).c_str());
+    for (std::size_t offset = 0; offset + size <= reduced.program.size(); offset += size) {
+        if (is_nop<Core>(reduced.program, offset)) continue;
+        const uint32_t opcode = read_word(reduced.program, offset, size);
+        std::printf("         %04X: %0*X  %s\n", static_cast<unsigned int>(PROGRAM_START + offset), Info::DIGITS,
+                    opcode, Disassembler::format(Info::ISA, opcode).c_str());
+    }
+
+    if (!options.repro.empty()) {
+        std::ofstream out(options.repro, std::ios::binary);
+        out.write(reinterpret_cast<const char*>(reduced.program.data()), static_cast<std::streamsize>(reduced.program.size()));
+        if (out) {
+            std::printf("       rerun: diff_engines --isa %s --rom %s %s --seed %u --steps %" PRIu64 " --engines %s,%s\n",
+                        Info::FLAG, options.repro.c_str(), Info::describe(reduced).c_str(), reduced.seed,
+                        reduced.steps, first.name, second.name);
+        } else {
+            std::printf("       cannot write %s\n", options.repro.c_str());
+        }
+    }
+}
+
+/// @brief 무작위 프로그램 검색 결과
+struct RandomResult {
+    Divergence divergence;
+    Case failing;
+    uint64_t executed = 0;
+    uint64_t programs = 0;
+};
+
+// 프로그램마다 master 난수열에서 새 시드를 뽑아 total개 이상 실행하거나 첫 불일치에서 멈춤
+template <typename Core>
+RandomResult search_random(const Engine<Core>& first, const Engine<Core>& second, const Options& options,
+                           uint64_t total) {
+    RandomResult result;
+    Xorshift32 master(options.seed);
+    while (result.executed < total || (options.single_program && result.programs == 0)) {
+        const uint32_t seed = options.single_program ? options.program_seed : master.next();
+        const Case c = IsaInfo<Core>::random_case(seed);
+        ++result.programs;
+        result.divergence = lockstep(first, second, c, options.block, &result.executed);
+        if (result.divergence.found) {
+            result.failing = c;
+            break;
+        }
+        if (options.single_program) break;
+    }
+    return result;
+}
+
+template <typename Core>
+std::string random_label(const Case& c) {
+    std::string label = std::string(IsaInfo<Core>::NAME) + " random program " + hex(c.seed);
+    const std::string config = IsaInfo<Core>::describe(c);
+    if (!config.empty()) label += " (" + config + ")";
+    return label;
+}
+
+template <typename Core>
+int check_random(const Engine<Core>& first, const Engine<Core>& second, const Options& options) {
+    const uint64_t start = timer::now_ns();
+    const RandomResult result = search_random(first, second, options, options.random);
+    const double seconds = static_cast<double>(timer::now_ns() - start) / timer::NS_PER_SECOND;
+
+    if (result.divergence.found) {
+        const Case reduced = reduce(first, second, result.failing, result.divergence, options.block);
+        report(first, second, random_label<Core>(result.failing), result.failing, result.divergence, reduced, options);
+        std::printf("       regenerate: diff_engines --isa %s --program %u --engines %s,%s\n",
+                    IsaInfo<Core>::FLAG, result.failing.seed, first.name, second.name);
+        return 1;
+    }
+    std::printf("[ OK ] %s random: %" PRIu64 " instructions in %" PRIu64 " programs, %.1f M instructions/s (%s vs %s)\n",
+                IsaInfo<Core>::NAME, result.executed, result.programs,
+                seconds > 0 ? static_cast<double>(result.executed) / seconds / 1e6 : 0.0, first.name, second.name);
+    return 0;
+}
+
+template <typename Core>
+int check_rom(const Engine<Core>& first, const Engine<Core>& second, const std::string& label, Case c,
+              const Options& options) {
+    c.steps = options.steps;
+    uint64_t executed = 0;
+    const Divergence divergence = lockstep(first, second, c, options.block, &executed);
+    if (divergence.found) {
+        report(first, second, label, c, divergence, reduce(first, second, c, divergence, options.block), options);
+        return 1;
+    }
+    std::printf("[ OK ] %s: %" PRIu64 " instructions (%s vs %s)\n", label.c_str(), executed, first.name, second.name);
+    return 0;
+}
+
+/**
+ * @brief 하네스 자체 검사: interpreter와 faulty를 비교해 불일치를 찾고,
+ * 처음 달라진 명령어가 심어 둔 결함의 명령어인지, 재현 프로그램이 몇 개 명령어로 줄어드는지 확인
+ */
+template <typename Core>
+int self_test(const Options& options) {
+    using Info = IsaInfo<Core>;
+    const Engine<Core>& reference = *find_engine<Core>("interpreter");
+    const Engine<Core>& faulty = *find_engine<Core>("faulty");
+
+    Options quiet = options;
+    quiet.single_program = false;
+    quiet.repro.clear();
+    const RandomResult result = search_random(reference, faulty, quiet, SELF_TEST_RANDOM);
+    if (!result.divergence.found) {
+        std::printf("[FAIL] %s self-test: injected fault not detected in %" PRIu64 " instructions\n",
+                    Info::NAME, result.executed);
+        return 1;
+    }
+
+    const uint32_t faulty_op = result.divergence.opcode;
+    const bool right_instruction = Info::ISA == Isa::Chip8 ? (faulty_op & 0xF00F) == 0x8004 : (faulty_op >> 24) == 0x07;
+    const Case reduced = reduce(reference, faulty, result.failing, result.divergence, options.block);
+    std::size_t kept = 0;
+    for (std::size_t offset = 0; offset < reduced.program.size(); offset += Core::INSTRUCTION_SIZE) {
+        if (!is_nop<Core>(reduced.program, offset)) ++kept;
+    }
+    const bool still_fails = lockstep(reference, faulty, reduced, options.block).found;
+
+    if (!right_instruction || !still_fails || kept > 2) {
+        report(reference, faulty, random_label<Core>(result.failing), result.failing, result.divergence, reduced, quiet);
+        std::printf("[FAIL] %s self-test: wrong instruction, reproducer does not fail, or not reduced (%zu instructions)\n",
+                    Info::NAME, kept);
+        return 1;
+    }
+    std::printf("[ OK ] %s self-test: fault found at %0*X (%s) after %" PRIu64 " instructions, reduced to %zu instruction(s)\n",
+                Info::NAME, Info::DIGITS, faulty_op, Disassembler::format(Info::ISA, faulty_op).c_str(),
+                result.divergence.index, kept);
+    return 0;
+}
+
+std::vector<std::string> list_roms(const std::string& dir) {
+    std::vector<std::string> roms;
+    if (DIR* d = opendir(dir.c_str())) {
+        while (dirent* entry = readdir(d)) {
+            std::string name = entry->d_name;
+            if (entry->d_type == DT_REG && name[0] != '.' && name != RomDatabase::DEFAULT_FILE) roms.push_back(dir + "/" + name);
+        }
+        closedir(d);
+    }
+    std::sort(roms.begin(), roms.end());
+    return roms;
+}
+
+bool split_engines(const std::string& text, std::string& first, std::string& second) {
+    const std::size_t comma = text.find(',');
+    if (comma == std::string::npos) return false;
+    first = text.substr(0, comma);
+    second = text.substr(comma + 1);
+    return true;
+}
+
+template <typename Core>
+bool pick_engines(const Options& options, const Engine<Core>*& first, const Engine<Core>*& second) {
+    std::string a, b;
+    if (!split_engines(options.engines, a, b)) return false;
+    first = find_engine<Core>(a);
+    second = find_engine<Core>(b);
+    return first && second;
+}
+
+// ROM 하나: 내용으로 코어를 고르고 (헤더 제거), 요청한 ISA가 아니면 건너뜀
+int run_rom_file(const std::string& path, const Options& options, bool want_8, bool want_32) {
+    RomImage rom;
+    if (rom.open(path.c_str()) != RomError::None) {
+        std::printf("[FAIL] %s: cannot open ROM\n", path.c_str());
+        return 1;
+    }
+    const RomDetection detection = detect_rom(rom.data(), rom.size());
+    Case c;
+    c.seed = options.seed;
+    c.program.assign(rom.data() + detection.offset, rom.data() + rom.size());
+
+    const std::string name = path.substr(path.find_last_of('/') + 1);
+    if (detection.kind == RomKind::Chip8) {
+        if (!want_8) return 0;
+        c.dialect = options.has_dialect ? options.dialect : detection.dialect;
+        c.quirks = options.quirks;
+        const Engine<Chip8>* first = nullptr;
+        const Engine<Chip8>* second = nullptr;
+        pick_engines(options, first, second);
+        return check_rom(*first, *second, name + " (" + dialect_key(c.dialect) + ")", c, options);
+    }
+    if (!want_32) return 0;
+    const Engine<Chip8_32>* first = nullptr;
+    const Engine<Chip8_32>* second = nullptr;
+    pick_engines(options, first, second);
+    return check_rom(*first, *second, name, c, options);
+}
+
+void usage(const char* program) {
+    std::fprintf(stderr,
+                 "Usage: %s [--isa 8|32|all] [--engines A,B] [--random N] [--seed S] [--program S] [--block N]\n"
+                 "          [--rom FILE] [--roms DIR] [--steps N] [--dialect D] [--quirks Q] [--repro FILE] [--self-test]\n"
+                 "Engines: interpreter, batched, faulty (deliberately wrong, for --self-test)\n",
+                 program);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options options;
+    bool want_8 = true;
+    bool want_32 = true;
+    bool self = false;
+    bool random_given = false;
+    std::vector<std::string> roms;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool has_value = i + 1 < argc;
+        if (arg == "--self-test") {
+            self = true;
+        } else if (!has_value) {
+            usage(argv[0]);
+            return 2;
+        } else if (arg == "--isa") {
+            const std::string isa = argv[++i];
+            want_8 = isa == "8" || isa == "all";
+            want_32 = isa == "32" || isa == "all";
+        } else if (arg == "--engines") {
+            options.engines = argv[++i];
+        } else if (arg == "--random") {
+            options.random = std::stoull(argv[++i]);
+            random_given = true;
+        } else if (arg == "--seed") {
+            options.seed = static_cast<uint32_t>(std::stoul(argv[++i], nullptr, 0));
+        } else if (arg == "--program") {
+            options.single_program = true;
+            options.program_seed = static_cast<uint32_t>(std::stoul(argv[++i], nullptr, 0));
+        } else if (arg == "--block") {
+            options.block = std::max(1u, static_cast<unsigned int>(std::stoul(argv[++i])));
+        } else if (arg == "--rom") {
+            roms.push_back(argv[++i]);
+        } else if (arg == "--roms") {
+            const std::vector<std::string> found = list_roms(argv[++i]);
+            roms.insert(roms.end(), found.begin(), found.end());
+        } else if (arg == "--steps") {
+            options.steps = std::stoull(argv[++i]);
+        } else if (arg == "--dialect") {
+            if (!parse_dialect(argv[++i], options.dialect)) {
+                usage(argv[0]);
+                return 2;
+            }
+            options.has_dialect = true;
+        } else if (arg == "--quirks") {
+            if (!parse_quirks(argv[++i], options.quirks)) {
+                usage(argv[0]);
+                return 2;
+            }
+        } else if (arg == "--repro") {
+            options.repro = argv[++i];
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (!want_8 && !want_32) {
+        usage(argv[0]);
+        return 2;
+    }
+    // ROM이나 --program만 준 경우 기본 무작위 검사는 건너뜀
+    if (!random_given && (!roms.empty() || options.single_program)) options.random = 0;
+
+    const Engine<Chip8>* first_8 = nullptr;
+    const Engine<Chip8>* second_8 = nullptr;
+    const Engine<Chip8_32>* first_32 = nullptr;
+    const Engine<Chip8_32>* second_32 = nullptr;
+    if (!pick_engines(options, first_8, second_8) || !pick_engines(options, first_32, second_32)) {
+        std::fprintf(stderr, "Unknown engine pair: %s\n", options.engines.c_str());
+        usage(argv[0]);
+        return 2;
+    }
+
+    // 기본 Sink를 등록하지 않으므로 무작위 프로그램이 내는 알 수 없는 opcode 경고는 모두 버려짐
+    OpcodeTable::Initialize();
+    OpcodeTable_32::Initialize();
+
+    int failures = 0;
+    if (self) {
+        if (want_8) failures += self_test<Chip8>(options);
+        if (want_32) failures += self_test<Chip8_32>(options);
+    }
+    for (const std::string& rom : roms) failures += run_rom_file(rom, options, want_8, want_32);
+    if (options.random > 0 || options.single_program) {
+        if (want_8) failures += check_random(*first_8, *second_8, options);
+        if (want_32) failures += check_random(*first_32, *second_32, options);
+    }
+
+    std::printf("%d failures\n", failures);
+    return failures ? 1 : 0;
+}
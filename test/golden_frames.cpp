@@ -0,0 +1,313 @@
+#include "core/chip8.hpp"
+#include "core/chip8_32.hpp"
+#include "core/opcode_table.hpp"
+#include "core/opcode_table_32.hpp"
+#include "core/rom_detect.hpp"
+#include "core/rom_db.hpp"
+#include "common/frame.hpp"
+#include "common/log_console.hpp"
+#include "timer.hpp"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <dirent.h>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * @file golden_frames.cpp
+ * @brief roms/의 모든 ROM을 헤드리스로 실행해 지정한 프레임의 화면 해시를 골든 값과 비교
+ *
+ * 사용법: golden_frames <roms 디렉토리> <골든 파일> [--update]
+ *
+ * 골든 파일 형식 (한 줄에 하나, '#'은 주석):
+ *   rom <파일 이름>             이후 줄이 적용될 ROM (같은 ROM을 quirk만 바꿔 여러 번 적어도 됨)
+ *   quirks <목록>               8비트 동작 차이 (--quirks 형식, 해당 조합으로 특수화된 디스패치 테이블로 실행)
+ *   key <프레임> <키> <+|->      해당 프레임 시작 시 키패드 키(16진수)를 누름(+) / 뗌(-)
+ *   frame <프레임> <해시>        해당 프레임을 마친 뒤 화면의 XXH64 (16진수 16자리)
+ *
+ * 코어는 확장자가 아니라 ROM 내용(detect_rom)으로 고른다.
+ * 한 ROM을 돌릴 수 있는 모든 엔진 변형(8비트는 방언별 디스패치 테이블)을 실행하며,
+ * 변형끼리도 모든 프레임 해시가 같아야 한다.
+ * --update는 첫 번째 변형의 결과로 해시를 다시 쓴다 (골든 파일에 없는 ROM은 기본 체크 프레임으로 추가).
+ */
+
+namespace {
+
+constexpr uint32_t GOLDEN_SEED = 0xC0FFEE;
+constexpr int DEFAULT_CHECK_INTERVAL = 30;   // 새 ROM의 기본 체크 간격 (프레임)
+constexpr int DEFAULT_CHECK_FRAMES = 600;    // 새 ROM의 기본 실행 길이 (10초)
+
+struct KeyStep {
+    int frame;
+    uint8_t key;
+    bool pressed;
+};
+
+struct RomScript {
+    std::string rom;
+    bool has_quirks = false;
+    Quirks quirks;
+    std::vector<KeyStep> keys;
+    std::vector<std::pair<int, uint64_t>> checks;  // (프레임, 해시)
+};
+
+// 엔진 변형: 스크립트를 실행하고 체크 프레임마다 해시를 돌려줌
+struct Variant {
+    const char* name;
+    std::function<std::vector<uint64_t>(const std::string& path, const RomScript& script)> run;
+};
+
+/// @brief 공통 프레임 루프: 키 적용 → 명령어 ipf개 → 타이머 → 체크 프레임이면 해시
+template <typename Core>
+std::vector<uint64_t> run_frames(Core& core, unsigned int ipf, const RomScript& script) {
+    std::vector<uint64_t> hashes;
+    int last_frame = 0;
+    for (const auto& check : script.checks) last_frame = std::max(last_frame, check.first);
+
+    size_t next_key = 0;
+    size_t next_check = 0;
+    for (int frame = 1; frame <= last_frame; ++frame) {
+        while (next_key < script.keys.size() && script.keys[next_key].frame <= frame) {
+            core.keypad[script.keys[next_key].key] = script.keys[next_key].pressed;
+            ++next_key;
+        }
+        for (unsigned int i = 0; i < ipf && !core.is_halted(); ++i) core.cycle();
+        core.tick_timers();
+
+        while (next_check < script.checks.size() && script.checks[next_check].first == frame) {
+            hashes.push_back(frame::hash(core.frame()));
+            ++next_check;
+        }
+    }
+    return hashes;
+}
+
+Variant chip8_variant(const char* name, Dialect dialect) {
+    return {name, [dialect](const std::string& path, const RomScript& script) {
+        Chip8 chip8;
+        chip8.set_dialect(dialect);
+        chip8.set_quirks(script.quirks);
+        chip8.set_seed(GOLDEN_SEED);
+        if (chip8.load_rom(path.c_str()) != RomError::None) return std::vector<uint64_t>{};
+        return run_frames(chip8, DEFAULT_IPF_8, script);
+    }};
+}
+
+std::vector<Variant> variants_for(const std::string& path) {
+    RomImage rom;
+    if (rom.open(path.c_str()) != RomError::None) return {};
+    if (detect_rom(rom.data(), rom.size()).kind == RomKind::Chip8) {
+        return {chip8_variant("chip8", Dialect::Chip8),
+                chip8_variant("schip", Dialect::SuperChip),
+                chip8_variant("xochip", Dialect::XoChip)};
+    }
+    return {{"chip8_32", [](const std::string& path, const RomScript& script) {
+        Chip8_32 chip8_32;
+        chip8_32.set_seed(GOLDEN_SEED);
+        if (chip8_32.load_rom(path.c_str()) != RomError::None) return std::vector<uint64_t>{};
+        return run_frames(chip8_32, DEFAULT_IPF_32, script);
+    }}};
+}
+
+bool load_golden(const std::string& path, std::vector<RomScript>& scripts) {
+    std::ifstream in(path);
+    if (!in) return false;
+    std::string line;
+    int line_no = 0;
+    while (std::getline(in, line)) {
+        ++line_no;
+        std::istringstream iss(line);
+        std::string word;
+        if (!(iss >> word) || word[0] == '#') continue;
+        if (word == "rom") {
+            RomScript script;
+            iss >> script.rom;
+            scripts.push_back(script);
+            continue;
+        }
+        if (scripts.empty()) {
+            std::fprintf(stderr, "%s:%d: '%s' before any 'rom' line\n", path.c_str(), line_no, word.c_str());
+            return false;
+        }
+        if (word == "quirks") {
+            std::string list;
+            iss >> list;
+            if (!parse_quirks(list, scripts.back().quirks)) {
+                std::fprintf(stderr, "%s:%d: unknown quirk in '%s'\n", path.c_str(), line_no, list.c_str());
+                return false;
+            }
+            scripts.back().has_quirks = true;
+        } else if (word == "key") {
+            int frame;
+            std::string key, action;
+            iss >> frame >> key >> action;
+            scripts.back().keys.push_back({frame, static_cast<uint8_t>(std::stoul(key, nullptr, 16) & 0xF), action == "+"});
+        } else if (word == "frame") {
+            int frame;
+            std::string hash;
+            iss >> frame >> hash;
+            scripts.back().checks.push_back({frame, std::stoull(hash, nullptr, 16)});
+        } else {
+            std::fprintf(stderr, "%s:%d: unknown directive '%s'\n", path.c_str(), line_no, word.c_str());
+            return false;
+        }
+    }
+    for (RomScript& script : scripts) {
+        std::stable_sort(script.keys.begin(), script.keys.end(),
+                         [](const KeyStep& a, const KeyStep& b) { return a.frame < b.frame; });
+        std::stable_sort(script.checks.begin(), script.checks.end(),
+                         [](const auto& a, const auto& b) { return a.first < b.first; });
+    }
+    return true;
+}
+
+bool save_golden(const std::string& path, const std::vector<RomScript>& scripts) {
+    std::ofstream out(path);
+    if (!out) return false;
+    out << "# 골든 프레임 해시 (test/golden_frames.cpp 참고, --update로 다시 생성)\n";
+    out << "# rom <파일> / quirks <목록> / key <프레임> <키> <+|-> / frame <프레임> <XXH64>\n";
+    for (const RomScript& script : scripts) {
+        out << "\nrom " << script.rom << "\n";
+        if (script.has_quirks) out << "quirks " << quirks_name(script.quirks) << "\n";
+        for (const KeyStep& step : script.keys) {
+            out << "key " << step.frame << " " << std::hex << static_cast<int>(step.key) << std::dec << " "
+                << (step.pressed ? "+" : "-") << "\n";
+        }
+        for (const auto& check : script.checks) {
+            char hash[17];
+            std::snprintf(hash, sizeof(hash), "%016" PRIx64, check.second);
+            out << "frame " << check.first << " " << hash << "\n";
+        }
+    }
+    return true;
+}
+
+std::vector<std::string> list_roms(const std::string& dir) {
+    std::vector<std::string> roms;
+    if (DIR* d = opendir(dir.c_str())) {
+        while (dirent* entry = readdir(d)) {
+            std::string name = entry->d_name;
+            if (entry->d_type == DT_REG && name[0] != '.' && name != RomDatabase::DEFAULT_FILE) roms.push_back(name);
+        }
+        closedir(d);
+    }
+    std::sort(roms.begin(), roms.end());
+    return roms;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        std::fprintf(stderr, "Usage: %s <roms dir> <golden file> [--update]\n", argv[0]);
+        return 2;
+    }
+    const std::string rom_dir = argv[1];
+    const std::string golden_path = argv[2];
+    const bool update = argc > 3 && std::strcmp(argv[3], "--update") == 0;
+
+    logging::install_console();
+    logging::set_level(logging::Level::Error);
+    OpcodeTable::Initialize();
+    OpcodeTable_32::Initialize();
+
+    std::vector<RomScript> scripts;
+    if (!load_golden(golden_path, scripts) && !update) {
+        std::fprintf(stderr, "Cannot read golden file: %s\n", golden_path.c_str());
+        return 2;
+    }
+
+    // 디렉토리의 ROM 중 골든 파일에 없는 것: --update면 추가, 아니면 실패
+    int failures = 0;
+    for (const std::string& rom : list_roms(rom_dir)) {
+        auto found = std::find_if(scripts.begin(), scripts.end(), [&](const RomScript& s) { return s.rom == rom; });
+        if (found != scripts.end()) continue;
+        if (!update) {
+            std::printf("[FAIL] %s: no golden entry (run with --update)\n", rom.c_str());
+            ++failures;
+            continue;
+        }
+        RomScript script;
+        script.rom = rom;
+        for (int frame = DEFAULT_CHECK_INTERVAL; frame <= DEFAULT_CHECK_FRAMES; frame += DEFAULT_CHECK_INTERVAL) {
+            script.checks.push_back({frame, 0});
+        }
+        scripts.push_back(script);
+    }
+
+    const uint64_t start = timer::now_ns();
+    size_t total_checks = 0;
+    for (RomScript& script : scripts) {
+        const std::string path = rom_dir + "/" + script.rom;
+        const std::string label = script.has_quirks ? script.rom + " [" + quirks_name(script.quirks) + "]" : script.rom;
+        std::vector<Variant> variants = variants_for(path);
+        if (variants.empty()) {
+            std::printf("[FAIL] %s: cannot open ROM\n", label.c_str());
+            ++failures;
+            continue;
+        }
+
+        const int failures_before = failures;
+        std::vector<uint64_t> reference;
+        for (const Variant& variant : variants) {
+            std::vector<uint64_t> hashes;
+            try {
+                hashes = variant.run(path, script);
+            } catch (const std::exception& e) {
+                std::printf("[FAIL] %s (%s): exception: %s\n", label.c_str(), variant.name, e.what());
+                ++failures;
+                continue;
+            }
+            if (hashes.size() != script.checks.size()) {
+                std::printf("[FAIL] %s (%s): failed to run\n", label.c_str(), variant.name);
+                ++failures;
+                continue;
+            }
+            total_checks += hashes.size();
+
+            // 변형끼리 비교 (첫 변형이 기준)
+            if (reference.empty()) {
+                reference = hashes;
+                if (update) {
+                    for (size_t i = 0; i < hashes.size(); ++i) script.checks[i].second = hashes[i];
+                }
+            }
+            for (size_t i = 0; i < hashes.size(); ++i) {
+                const int frame = script.checks[i].first;
+                if (hashes[i] != reference[i]) {
+                    std::printf("[FAIL] %s (%s): frame %d differs from %s\n",
+                                label.c_str(), variant.name, frame, variants.front().name);
+                    ++failures;
+                    break;
+                }
+                if (hashes[i] != script.checks[i].second) {
+                    std::printf("[FAIL] %s (%s): frame %d hash %016" PRIx64 ", expected %016" PRIx64 "\n",
+                                label.c_str(), variant.name, frame, hashes[i], script.checks[i].second);
+                    ++failures;
+                    break;
+                }
+            }
+        }
+        std::printf("[%s] %s (%zu variants, %zu frames)\n", failures > failures_before ? "FAIL" : " OK ",
+                    label.c_str(), variants.size(), script.checks.size());
+    }
+
+    if (update) {
+        if (!save_golden(golden_path, scripts)) {
+            std::fprintf(stderr, "Cannot write golden file: %s\n", golden_path.c_str());
+            return 2;
+        }
+        std::printf("Updated %s\n", golden_path.c_str());
+    }
+
+    const double ms = static_cast<double>(timer::now_ns() - start) / timer::NS_PER_MS;
+    std::printf("%zu frame checks across %zu ROMs in %.1f ms, %d failures\n",
+                total_checks, scripts.size(), ms, failures);
+    return failures ? 1 : 0;
+}
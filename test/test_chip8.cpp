@@ -1,19 +1,55 @@
 #define CATCH_CONFIG_MAIN
 #include "catch.hpp"
-#include "../include/core/chip8.hpp"
+#include "core/chip8.hpp"
+#include "core/chip8core.h"
+#include "core/chip8_32.hpp"
+#include "core/machine.hpp"
+#include "core/opcode_table.hpp"
+#include "core/opcode_table_32.hpp"
+#include "core/rom_detect.hpp"
+#include "core/rom_db.hpp"
+#include "debugger/disassembler.hpp"
+#include "debugger/expression.hpp"
+#include "common/log.hpp"
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <algorithm>
+#include <vector>
 
 /**
  * @file test_chip8.cpp
- * @brief CHIP-8의 핵심 기능에 대한 유닛 테스트 코드 (Catch2 기반)
+ * @brief CHIP-8의 핵심 기능에 대한 유닛 테스트 코드 (Catch2 기반, 공개 API만 사용)
  */
 
+// 디스패치 테이블은 테스트 실행 전에 한 번 채움 (Catch2 main보다 먼저 초기화됨)
+static const bool tables_initialized = (OpcodeTable::Initialize(), OpcodeTable_32::Initialize(), true);
+
+// 0x200부터 opcode를 차례로 기록
+static void load_program(Chip8& chip8, std::initializer_list<uint16_t> opcodes) {
+    uint16_t address = 0x200;
+    for (uint16_t opcode : opcodes) {
+        chip8.set_memory(address++, static_cast<uint8_t>(opcode >> 8));
+        chip8.set_memory(address++, static_cast<uint8_t>(opcode & 0xFF));
+    }
+    chip8.set_pc(0x200);
+}
+
+// 0x200부터 32비트 opcode를 빅엔디언으로 차례로 기록
+static void load_program_32(Chip8_32& chip8_32, std::initializer_list<uint32_t> opcodes) {
+    uint32_t address = 0x200;
+    for (uint32_t opcode : opcodes) {
+        for (int shift = 24; shift >= 0; shift -= 8) chip8_32.set_memory(address++, static_cast<uint8_t>(opcode >> shift));
+    }
+    chip8_32.set_pc(0x200);
+}
+
 TEST_CASE("00E0: Clear screen", "[opcode]") {
     Chip8 chip8;
     // 화면을 채운 다음 00E0 명령어를 실행해서 클리어 되는지 확인
     std::fill(chip8.video.begin(), chip8.video.end(), 1);
-    chip8.memory[0x200] = 0x00;
-    chip8.memory[0x201] = 0xE0;
-    chip8.pc = 0x200;
+    load_program(chip8, {0x00E0});
     chip8.cycle();
 
     REQUIRE(std::all_of(chip8.video.begin(), chip8.video.end(), [](uint8_t px) { return px == 0; }));
@@ -21,49 +57,1017 @@ TEST_CASE("00E0: Clear screen", "[opcode]") {
 
 TEST_CASE("6XNN: Set Vx", "[opcode]") {
     Chip8 chip8;
-    chip8.memory[0x200] = 0x60;  // 6XNN: Set VX
-    chip8.memory[0x201] = 0x0A;  // V0 = 0x0A
-    chip8.pc = 0x200;
+    load_program(chip8, {0x600A});  // V0 = 0x0A
     chip8.cycle();
 
-    REQUIRE(chip8.V[0] == 0x0A);
+    REQUIRE(chip8.get_V(0) == 0x0A);
 }
 
 TEST_CASE("7XNN: Add NN to Vx", "[opcode]") {
     Chip8 chip8;
-    chip8.V[1] = 0x05;
-    chip8.memory[0x200] = 0x71;  // 7XNN: Add to V1
-    chip8.memory[0x201] = 0x03;  // V1 += 0x03
-    chip8.pc = 0x200;
+    chip8.set_V(1, 0x05);
+    load_program(chip8, {0x7103});  // V1 += 0x03
     chip8.cycle();
 
-    REQUIRE(chip8.V[1] == 0x08);
+    REQUIRE(chip8.get_V(1) == 0x08);
 }
 
 TEST_CASE("ANNN: Set I", "[opcode]") {
     Chip8 chip8;
-    chip8.memory[0x200] = 0xA2;  // ANNN
-    chip8.memory[0x201] = 0xF0;  // I = 0x2F0
-    chip8.pc = 0x200;
+    load_program(chip8, {0xA2F0});  // I = 0x2F0
     chip8.cycle();
 
-    REQUIRE(chip8.I == 0x2F0);
+    REQUIRE(chip8.get_I() == 0x2F0);
 }
 
 TEST_CASE("2NNN & 00EE: Call & Return", "[opcode]") {
     Chip8 chip8;
     // 서브루틴 호출
-    chip8.memory[0x200] = 0x22;
-    chip8.memory[0x201] = 0x10;  // CALL 0x210
-    chip8.memory[0x210] = 0x00;
-    chip8.memory[0x211] = 0xEE;  // RET
+    load_program(chip8, {0x2210});  // CALL 0x210
+    chip8.set_memory(0x210, 0x00);
+    chip8.set_memory(0x211, 0xEE);  // RET
 
-    chip8.pc = 0x200;
     chip8.cycle();
-    REQUIRE(chip8.pc == 0x210);
-    REQUIRE(chip8.sp == 1);
+    REQUIRE(chip8.get_pc() == 0x210);
+    REQUIRE(chip8.get_sp() == 1);
 
     chip8.cycle();  // RET 실행
-    REQUIRE(chip8.pc == 0x202);
-    REQUIRE(chip8.sp == 0);
+    REQUIRE(chip8.get_pc() == 0x202);
+    REQUIRE(chip8.get_sp() == 0);
+}
+
+TEST_CASE("2NNN & 00EE: Stack underflow and overflow are skipped", "[opcode]") {
+    Chip8 chip8;
+    load_program(chip8, {0x00EE, 0x2204});  // 빈 스택에서 RET, 가득 찬 스택에서 CALL
+    chip8.cycle();
+    REQUIRE(chip8.get_pc() == 0x202);
+    REQUIRE(chip8.get_sp() == 0);
+
+    chip8.set_sp(STACK_SIZE);
+    chip8.cycle();
+    REQUIRE(chip8.get_pc() == 0x204);
+    REQUIRE(chip8.get_sp() == STACK_SIZE);
+}
+
+TEST_CASE("CXNN: Seeded random is reproducible", "[opcode]") {
+    Chip8 a;
+    Chip8 b;
+    a.set_seed(1234);
+    b.set_seed(1234);
+    load_program(a, {0xC0FF, 0xC1FF, 0xC20F});
+    load_program(b, {0xC0FF, 0xC1FF, 0xC20F});
+    for (int i = 0; i < 3; ++i) {
+        a.cycle();
+        b.cycle();
+    }
+
+    REQUIRE(a.get_V(0) == b.get_V(0));
+    REQUIRE(a.get_V(1) == b.get_V(1));
+    REQUIRE(a.get_V(2) == b.get_V(2));
+    REQUIRE(a.get_V(2) <= 0x0F);
+}
+
+TEST_CASE("MachineCore: run, snapshot and restore", "[core]") {
+    Chip8 chip8;
+    load_program(chip8, {0x6005, 0x7001, 0x1202});  // V0 = 5, 이후 V0 += 1 반복
+    REQUIRE(chip8.run(3) == 3);
+    REQUIRE(chip8.get_V(0) == 6);
+
+    const Chip8 saved = chip8.snapshot();
+    REQUIRE(chip8.run(4) == 4);
+    REQUIRE(chip8.get_V(0) == 8);
+
+    chip8.restore(saved);
+    REQUIRE(chip8.get_V(0) == 6);
+    REQUIRE(chip8.get_pc() == 0x202);
+
+    chip8.halt();
+    REQUIRE(chip8.run(10) == 0);
+}
+
+TEST_CASE("Machine: Batches, input and snapshots through the interface", "[core]") {
+    CoreMachine<Chip8> machine("8-bit CHIP-8");
+    const uint8_t program[] = {0x60, 0x05, 0x70, 0x01, 0x12, 0x02};
+    REQUIRE(machine.load(program, sizeof(program)) == RomError::None);
+
+    InputScheduler input;
+    REQUIRE(machine.run_batch(3, input) == 3);
+    REQUIRE(machine.stats().instructions == 3);
+
+    std::unique_ptr<Machine> saved = machine.snapshot();
+    machine.run_batch(4, input);
+    REQUIRE(machine.core().get_V(0) == 8);
+    REQUIRE(machine.restore(*saved));
+    REQUIRE(machine.core().get_V(0) == 6);
+    REQUIRE(machine.stats().instructions == 3);
+
+    // 다른 코어의 스냅샷은 거부
+    CoreMachine<Chip8_32> other("32-bit CHIP-8");
+    REQUIRE(!machine.restore(other));
+
+    machine.core().halt();
+    REQUIRE(machine.run_batch(10, input) == 0);
+}
+
+struct HookLog {
+    std::vector<uint32_t> pcs;
+    uint32_t stop_at = 0xFFFF;
+};
+
+static bool record_hook(void* user, uint32_t pc) {
+    auto* log = static_cast<HookLog*>(user);
+    log->pcs.push_back(pc);
+    return pc == log->stop_at;
+}
+
+TEST_CASE("DebugHook: run_batch checks the PC mask and stops before the instruction", "[core]") {
+    CoreMachine<Chip8> machine("8-bit CHIP-8");
+    // V0 = 5, 이후 V0 += 1 / V1 += 1 / 0x202로 반복
+    const uint8_t program[] = {0x60, 0x05, 0x70, 0x01, 0x71, 0x01, 0x12, 0x02};
+    REQUIRE(machine.load(program, sizeof(program)) == RomError::None);
+
+    std::vector<bool> mask(machine.core().memory_size(), false);
+    mask[0x204] = true;
+    HookLog log;
+    machine.core().set_debug_hook({&mask, record_hook, &log});
+
+    // 한 묶음 안에서 0x204를 지날 때마다 호출되고, 나머지 PC에서는 호출되지 않음
+    InputScheduler input;
+    REQUIRE(machine.run_batch(10, input) == 10);
+    REQUIRE(log.pcs == std::vector<uint32_t>{0x204, 0x204, 0x204});
+
+    // 멈추라고 하면 그 명령어를 실행하지 않고 묶음이 끝남
+    log.stop_at = 0x204;
+    REQUIRE(machine.run_batch(10, input) == 1);
+    REQUIRE(machine.core().get_pc() == 0x204);
+    REQUIRE(machine.core().get_V(1) == 3);
+
+    machine.core().set_debug_hook(DebugHook{});
+    REQUIRE(machine.run_batch(10, input) == 10);
+}
+
+TEST_CASE("DebugHook: A pending watchpoint hit calls the hook at any PC", "[core]") {
+    CoreMachine<Chip8> machine("8-bit CHIP-8");
+    // I = 0x300 / [I] = V0 / 0x204에서 제자리 반복
+    const uint8_t program[] = {0xA3, 0x00, 0xF0, 0x55, 0x12, 0x04};
+    REQUIRE(machine.load(program, sizeof(program)) == RomError::None);
+    machine.core().memory_watch().add({0x300, 1, WatchKind::Write, std::nullopt});
+
+    HookLog log;
+    log.stop_at = 0x204;
+    machine.core().set_debug_hook({nullptr, record_hook, &log});
+    InputScheduler input;
+    REQUIRE(machine.run_batch(10, input) == 2);
+    REQUIRE(log.pcs == std::vector<uint32_t>{0x204});
+    REQUIRE(machine.core().memory_watch().has_hits());
+}
+
+TEST_CASE("MemoryWatch: FX55 and FX33 writes report PC and old/new values", "[watch]") {
+    Chip8 chip8;
+    load_program(chip8, {0xA300, 0x6011, 0x6122, 0xF155, 0xA400, 0xF155, 0xA310, 0xF155});
+    chip8.set_memory(0x301, 0x99);
+    chip8.memory_watch().add({0x300, 4, WatchKind::Write, std::nullopt});
+    for (int i = 0; i < 4; ++i) chip8.cycle();
+
+    std::vector<WatchHit> hits = chip8.memory_watch().take_hits();
+    REQUIRE(hits.size() == 2);
+    REQUIRE(hits[0].pc == 0x206);
+    REQUIRE(hits[0].address == 0x300);
+    REQUIRE(hits[0].old_value == 0x00);
+    REQUIRE(hits[0].new_value == 0x11);
+    REQUIRE(hits[0].kind == WatchKind::Write);
+    REQUIRE(hits[1].address == 0x301);
+    REQUIRE(hits[1].old_value == 0x99);
+    REQUIRE(hits[1].new_value == 0x22);
+    REQUIRE_FALSE(chip8.memory_watch().has_hits());
+
+    // 감시하지 않는 페이지 / 같은 페이지의 감시 범위 밖 쓰기는 히트 없음
+    for (int i = 0; i < 4; ++i) chip8.cycle();
+    REQUIRE(chip8.get_memory(0x400) == 0x11);
+    REQUIRE(chip8.get_memory(0x310) == 0x11);
+    REQUIRE_FALSE(chip8.memory_watch().has_hits());
+
+    // 값 조건: BCD 1, 2, 5 중 5를 쓰는 0x302만 히트
+    chip8.memory_watch().clear();
+    chip8.memory_watch().add({0x300, 3, WatchKind::Write, uint8_t{5}});
+    load_program(chip8, {0xA300, 0x607D, 0xF033});
+    for (int i = 0; i < 3; ++i) chip8.cycle();
+    hits = chip8.memory_watch().take_hits();
+    REQUIRE(hits.size() == 1);
+    REQUIRE(hits[0].pc == 0x204);
+    REQUIRE(hits[0].address == 0x302);
+    REQUIRE(hits[0].new_value == 5);
+}
+
+TEST_CASE("MemoryWatch: FX65 and DXYN reads hit only watched addresses", "[watch]") {
+    Chip8 chip8;
+    load_program(chip8, {0xA300, 0xF265, 0xA500, 0xD015, 0xA300, 0xD011});
+    chip8.set_memory(0x300, 0x05);
+    chip8.set_memory(0x301, 0x06);
+    chip8.set_memory(0x302, 0x07);
+    chip8.memory_watch().add({0x300, 2, WatchKind::Read, std::nullopt});
+    chip8.cycle();
+    chip8.cycle();
+
+    std::vector<WatchHit> hits = chip8.memory_watch().take_hits();
+    REQUIRE(hits.size() == 2);
+    REQUIRE(hits[0].pc == 0x202);
+    REQUIRE(hits[0].kind == WatchKind::Read);
+    REQUIRE(hits[0].address == 0x300);
+    REQUIRE(hits[0].old_value == 0x05);
+    REQUIRE(hits[0].new_value == 0x05);
+    REQUIRE(hits[1].address == 0x301);
+    REQUIRE(chip8.get_V(2) == 0x07);
+
+    // 스프라이트 읽기: 감시 안 하는 0x500에서는 히트 없음, 0x300에서는 한 번
+    chip8.memory_watch().clear();
+    chip8.memory_watch().add({0x300, 1, WatchKind::Access, std::nullopt});
+    chip8.cycle();
+    chip8.cycle();
+    REQUIRE_FALSE(chip8.memory_watch().has_hits());
+    chip8.cycle();
+    chip8.cycle();
+    hits = chip8.memory_watch().take_hits();
+    REQUIRE(hits.size() == 1);
+    REQUIRE(hits[0].pc == 0x20A);
+    REQUIRE(hits[0].kind == WatchKind::Read);
+
+    // 값 조건이 맞지 않는 읽기는 히트 없음
+    chip8.memory_watch().clear();
+    chip8.memory_watch().add({0x300, 3, WatchKind::Read, uint8_t{0x42}});
+    load_program(chip8, {0xA300, 0xF265});
+    chip8.cycle();
+    chip8.cycle();
+    REQUIRE_FALSE(chip8.memory_watch().has_hits());
+}
+
+TEST_CASE("MemoryWatch: Pending hits are capped at MAX_PENDING_HITS", "[watch]") {
+    using Watch = MemoryWatch<Chip8Traits::MEMORY>;
+    Chip8 chip8;
+    load_program(chip8, {0xA300, 0xFF55, 0xA310, 0xF155});
+    for (int i = 0; i < 16; ++i) chip8.set_V(i, static_cast<uint8_t>(i + 1));
+    chip8.memory_watch().add({0x300, 32, WatchKind::Write, std::nullopt});
+    for (int i = 0; i < 4; ++i) chip8.cycle();
+
+    // 먼저 쌓인 16개만 남고 이후 히트는 버림
+    std::vector<WatchHit> hits = chip8.memory_watch().take_hits();
+    REQUIRE(hits.size() == Watch::MAX_PENDING_HITS);
+    REQUIRE(hits.front().address == 0x300);
+    REQUIRE(hits.back().address == 0x30F);
+    REQUIRE(hits.back().new_value == 16);
+    REQUIRE(chip8.get_memory(0x311) == 2);   // 기록은 버려져도 쓰기는 수행됨
+    REQUIRE_FALSE(chip8.memory_watch().has_hits());
+}
+
+TEST_CASE("chip8core C API: Load, run, keys and snapshots", "[capi]") {
+    chip8core* core = chip8core_create(CHIP8CORE_KIND_CHIP8);
+    REQUIRE(core != nullptr);
+    REQUIRE(chip8core_create(7) == nullptr);
+
+    // V0 = 5 / V0 += 1 반복, 키 V3(= 0)이 눌려 있으면 00FD(종료)로
+    const uint8_t program[] = {0x60, 0x05, 0x70, 0x01, 0xE3, 0xA1, 0x00, 0xFD, 0x12, 0x02};
+    REQUIRE(chip8core_load_rom(core, program, 0) == CHIP8CORE_ERROR_EMPTY);
+    REQUIRE(chip8core_set_dialect(core, CHIP8CORE_DIALECT_SUPERCHIP) == CHIP8CORE_OK);
+    REQUIRE(chip8core_load_rom(core, program, sizeof(program)) == CHIP8CORE_OK);
+    REQUIRE(chip8core_run(core, 100) == 100);
+    REQUIRE(!chip8core_is_halted(core));
+
+    unsigned int width = 0, height = 0;
+    REQUIRE(chip8core_framebuffer(core, &width, &height) != nullptr);
+    REQUIRE(width == VIDEO_WIDTH);
+    REQUIRE(height == VIDEO_HEIGHT);
+
+    chip8core_snapshot* saved = chip8core_snapshot_create(core);
+    REQUIRE(chip8core_set_key(core, 0x0, 1) == CHIP8CORE_OK);
+    REQUIRE(chip8core_set_key(core, 16, 1) == CHIP8CORE_ERROR_ARGUMENT);
+    chip8core_run(core, 100);
+    REQUIRE(chip8core_is_halted(core));
+
+    REQUIRE(chip8core_snapshot_restore(core, saved) == CHIP8CORE_OK);
+    REQUIRE(!chip8core_is_halted(core));
+
+    chip8core* wide = chip8core_create(CHIP8CORE_KIND_CHIP8_32);
+    REQUIRE(chip8core_set_dialect(wide, CHIP8CORE_DIALECT_CHIP8) == CHIP8CORE_ERROR_ARGUMENT);
+    REQUIRE(chip8core_snapshot_restore(wide, saved) == CHIP8CORE_ERROR_ARGUMENT);
+
+    chip8core_snapshot_destroy(saved);
+    chip8core_destroy(wide);
+    chip8core_destroy(core);
+}
+
+TEST_CASE("chip8core C API: A faulting run halts and reports what it executed", "[capi]") {
+    chip8core* core = chip8core_create(CHIP8CORE_KIND_CHIP8);
+    // I = 0xFFF / V0 = 1 / F165가 0x1000을 읽음 (4KB 메모리 밖)
+    const uint8_t program[] = {0xAF, 0xFF, 0x60, 0x01, 0xF1, 0x65, 0x12, 0x00};
+    REQUIRE(chip8core_load_rom(core, program, sizeof(program)) == CHIP8CORE_OK);
+    REQUIRE(chip8core_run(core, 10) == 2);
+    REQUIRE(chip8core_is_halted(core));
+    REQUIRE(chip8core_run(core, 10) == 0);
+    chip8core_destroy(core);
+}
+
+struct LogCapture {
+    std::vector<int> levels;
+    std::vector<std::string> categories;
+};
+
+static void capture_log(void* user, int level, const char* category, const char*) {
+    auto* capture = static_cast<LogCapture*>(user);
+    capture->levels.push_back(level);
+    capture->categories.push_back(category);
+}
+
+TEST_CASE("chip8core C API: Log messages go only to the instance's callback", "[capi]") {
+    chip8core* logged = chip8core_create(CHIP8CORE_KIND_CHIP8);
+    chip8core* silent = chip8core_create(CHIP8CORE_KIND_CHIP8);
+    LogCapture capture;
+    REQUIRE(chip8core_set_log_callback(logged, capture_log, &capture, CHIP8CORE_LOG_WARN) == CHIP8CORE_OK);
+    REQUIRE(chip8core_set_log_callback(logged, capture_log, &capture, 9) == CHIP8CORE_ERROR_ARGUMENT);
+
+    // 빈 스택에서 00EE: 경고 한 번 (cpu8)
+    const uint8_t program[] = {0x00, 0xEE, 0x12, 0x02};
+    chip8core_load_rom(logged, program, sizeof(program));
+    chip8core_load_rom(silent, program, sizeof(program));
+    chip8core_run(silent, 4);
+    REQUIRE(capture.levels.empty());
+
+    chip8core_run(logged, 4);
+    REQUIRE(capture.levels.size() == 1);
+    REQUIRE(capture.levels[0] == CHIP8CORE_LOG_WARN);
+    REQUIRE(capture.categories[0] == "cpu8");
+
+    REQUIRE(chip8core_set_log_callback(logged, capture_log, &capture, CHIP8CORE_LOG_ERROR) == CHIP8CORE_OK);
+    chip8core_reset(logged);
+    chip8core_load_rom(logged, program, sizeof(program));
+    chip8core_run(logged, 4);
+    REQUIRE(capture.levels.size() == 1);
+
+    chip8core_destroy(silent);
+    chip8core_destroy(logged);
+}
+
+TEST_CASE("load_rom_data: Size is checked against the dialect", "[rom]") {
+    Chip8 chip8;
+    const uint8_t program[] = {0x60, 0x2A};
+    REQUIRE(chip8.load_rom_data(program, sizeof(program)) == RomError::None);
+    REQUIRE(chip8.get_memory(0x200) == 0x60);
+    REQUIRE(chip8.get_memory(0x201) == 0x2A);
+    REQUIRE(chip8.load_rom_data(program, 0) == RomError::Empty);
+
+    // CHIP-8 프로그램 영역은 3584바이트, XO-CHIP은 같은 이미지를 받아들임
+    std::vector<uint8_t> large(MEMORY_SIZE - 0x200 + 1, 0xAA);
+    REQUIRE(chip8.load_rom_data(large.data(), large.size()) == RomError::TooLarge);
+    chip8.set_dialect(Dialect::XoChip);
+    REQUIRE(chip8.load_rom_data(large.data(), large.size()) == RomError::None);
+}
+
+TEST_CASE("load_rom: Missing file reports OpenFailed", "[rom]") {
+    Chip8 chip8;
+    REQUIRE(chip8.load_rom("/nonexistent/rom.ch8") == RomError::OpenFailed);
+}
+
+TEST_CASE("detect_rom: Core and dialect from content", "[rom]") {
+    // 8비트: LD V0, 0x2A / HIGH / HIGH / JP 0x200
+    const uint8_t schip[] = {0x60, 0x2A, 0x00, 0xFF, 0x00, 0xFF, 0x12, 0x00};
+    RomDetection detection = detect_rom(schip, sizeof(schip));
+    REQUIRE(detection.kind == RomKind::Chip8);
+    REQUIRE(detection.dialect == Dialect::SuperChip);
+
+    // 32비트: LD R10, 0x0002 / JP 0x000200
+    const uint8_t wide[] = {0x06, 0x0A, 0x00, 0x02, 0x01, 0x00, 0x02, 0x00};
+    detection = detect_rom(wide, sizeof(wide));
+    REQUIRE(detection.kind == RomKind::Chip8_32);
+    REQUIRE(detection.confident);
+
+    // 헤더가 있으면 내용과 무관하게 헤더를 따르고 프로그램은 헤더 뒤부터
+    const uint8_t header[] = {'C', '8', 'R', 'M', 1, 0, 0, 0, 0x60, 0x2A};
+    detection = detect_rom(header, sizeof(header));
+    REQUIRE(detection.from_header);
+    REQUIRE(detection.kind == RomKind::Chip8_32);
+    REQUIRE(detection.offset == ROM_HEADER_SIZE);
+}
+
+TEST_CASE("Quirks: shift, memory, vfreset, jump", "[quirks]") {
+    Chip8 chip8;
+    Quirks quirks;
+    quirks.shift_vy = true;
+    quirks.memory_i = true;
+    quirks.vf_reset = true;
+    quirks.jump_vx = true;
+    chip8.set_quirks(quirks);
+    // V1 = 0x81, V2 = 0x03, V0 = V2 >> 1 (shift), VF = 1 / V3 |= V1 (VF = 0) / I = 0x300, [I] = V0..V1 / JP V1 + 0x100
+    load_program(chip8, {0x6181, 0x6203, 0x8026, 0x8311, 0xA300, 0xF155, 0xB100});
+    chip8.cycle();
+    chip8.cycle();
+    chip8.cycle();
+    REQUIRE(chip8.get_V(0) == 0x01);
+    REQUIRE(chip8.get_V(0xF) == 1);
+    chip8.cycle();
+    REQUIRE(chip8.get_V(3) == 0x81);
+    REQUIRE(chip8.get_V(0xF) == 0);
+    chip8.cycle();
+    chip8.cycle();
+    REQUIRE(chip8.get_I() == 0x302);
+    chip8.cycle();
+    REQUIRE(chip8.get_pc() == 0x100 + 0x81);
+}
+
+TEST_CASE("RomDatabase: Parse and lookup by hash", "[rom]") {
+    const char* text =
+        "# comment\n"
+        "00000000000000aa name=a.ch8 ipf=20 dialect=schip quirks=shift,clip\n"
+        "not-a-hash ipf=1\n"
+        "00000000000000bb ipf=7\n";
+    RomDatabase db;
+    REQUIRE(db.parse(text, std::strlen(text)) == 1);
+    REQUIRE(db.size() == 2);
+
+    const RomProfile* a = db.find(0xAA);
+    REQUIRE(a != nullptr);
+    REQUIRE(a->name == "a.ch8");
+    REQUIRE(a->ipf == 20);
+    REQUIRE(a->has_dialect);
+    REQUIRE(a->dialect == Dialect::SuperChip);
+    REQUIRE(a->quirks.shift_vy);
+    REQUIRE(a->quirks.clip);
+    REQUIRE_FALSE(a->quirks.memory_i);
+    REQUIRE(RomDatabase::format_line(0xAA, *a) == "00000000000000aa name=a.ch8 ipf=20 dialect=schip quirks=shift,clip");
+    REQUIRE(db.find(0xBB)->ipf == 7);
+    REQUIRE(db.find(0xCC) == nullptr);
+}
+
+// 핸들러가 미정의 opcode 경로(OP_UNKNOWN / OP_UNIMPLEMENTED)를 거쳤는지 경고 메시지로 확인
+struct UnknownCapture {
+    const char* prefix;
+    bool hit = false;
+};
+
+static void capture_unknown(void* user, logging::Level, logging::Category, const char* text) {
+    auto* capture = static_cast<UnknownCapture*>(user);
+    if (std::strncmp(text, capture->prefix, std::strlen(capture->prefix)) == 0) capture->hit = true;
+}
+
+TEST_CASE("OpcodeTable: Lookup matches the handlers for every opcode in every dialect", "[opcode]") {
+    UnknownCapture capture{"Unknown opcode"};
+    logging::Sink sink(capture_unknown, &capture);
+    logging::ScopedSink scope(&sink);
+
+    for (unsigned int d = 0; d < NUM_DIALECTS; ++d) {
+        const Dialect dialect = static_cast<Dialect>(d);
+        Chip8 chip8;
+        chip8.set_dialect(dialect);
+        std::vector<uint16_t> mismatches;
+        for (uint32_t op = 0; op <= 0xFFFF; ++op) {
+            const uint16_t opcode = static_cast<uint16_t>(op);
+            // 이전 명령어의 영향을 지움 (레지스터 값이 키 번호/주소로 쓰임)
+            for (int i = 0; i < 16; ++i) chip8.set_V(i, 0);
+            chip8.set_I(0x300);
+            chip8.set_sp(0);
+            chip8.set_pc(0x200);
+            capture.hit = false;
+            OpcodeTable::Execute(chip8, opcode);
+            const bool defined = OpcodeTable::Lookup(opcode, dialect) != nullptr;
+            if (defined == capture.hit) mismatches.push_back(opcode);
+        }
+        INFO(dialect_name(dialect) << ": first mismatch 0x" << std::hex << (mismatches.empty() ? 0 : mismatches[0]));
+        REQUIRE(mismatches.empty());
+    }
+
+    // 방언별 정의: 확장 명령은 낮은 방언에서 미정의, 0NNN 자리는 SYS로 떨어짐
+    REQUIRE(OpcodeTable::Lookup(0x5012, Dialect::SuperChip) == nullptr);
+    REQUIRE(std::strcmp(OpcodeTable::Lookup(0x5012, Dialect::XoChip)->mnemonic, "SAVE") == 0);
+    REQUIRE(std::strcmp(OpcodeTable::Lookup(0x00FF, Dialect::Chip8)->mnemonic, "SYS") == 0);
+    REQUIRE(std::strcmp(OpcodeTable::Lookup(0x00FF)->mnemonic, "HIGH") == 0);
+    REQUIRE(OpcodeTable::Lookup(0xF030, Dialect::Chip8) == nullptr);
+}
+
+TEST_CASE("OpcodeTable_32: Lookup matches the primary, packed and group handlers", "[opcode]") {
+    // 빈 primary slot은 어떤 operand로도 정의가 없어야 함
+    for (uint32_t slot = 0; slot < OPCODE_TABLE_SIZE_32; ++slot) {
+        const bool stub = OpcodeTable_32::primary_table_32[slot] == OpcodeTable_32::OP_UNIMPLEMENTED;
+        bool any_defined = false;
+        for (uint32_t low = 0; low <= 0xFFFF && !any_defined; ++low) {
+            any_defined = OpcodeTable_32::Lookup((slot << 24) | (low << 8)) ||
+                          OpcodeTable_32::Lookup((slot << 24) | low);
+        }
+        INFO("slot 0x" << std::hex << slot);
+        REQUIRE(any_defined != stub);
+    }
+    for (uint32_t zz = 0; zz < PACKED_TABLE_SIZE_32; ++zz) {
+        const bool stub = OpcodeTable_32::packed_table_32[zz] == OpcodeTable_32::OP_UNIMPLEMENTED;
+        INFO("packed 0x" << std::hex << zz);
+        REQUIRE((OpcodeTable_32::Lookup(0x14010200 | zz) == nullptr) == stub);
+    }
+
+    // 채워진 slot은 하위 16비트 전체를 실행해 세부 코드 switch의 미정의 경로까지 확인 (X = R0)
+    UnknownCapture capture{"Unimplemented 32-bit opcode"};
+    logging::Sink sink(capture_unknown, &capture);
+    logging::ScopedSink scope(&sink);
+    Chip8_32 chip8_32;
+    std::vector<uint32_t> mismatches;
+    for (uint32_t slot = 0; slot < OPCODE_TABLE_SIZE_32; ++slot) {
+        if (OpcodeTable_32::primary_table_32[slot] == OpcodeTable_32::OP_UNIMPLEMENTED) continue;
+        for (uint32_t low = 0; low <= 0xFFFF; ++low) {
+            const uint32_t opcode = (slot << 24) | low;
+            chip8_32.set_R(0, 0);
+            chip8_32.set_I(0x300);
+            chip8_32.set_sp(0);
+            chip8_32.set_pc(0x200);
+            capture.hit = false;
+            try {
+                OpcodeTable_32::Execute(chip8_32, opcode);
+            } catch (const std::out_of_range&) {
+                continue;  // Y 자리가 R32 이상이면 세부 코드를 보기 전에 레지스터 접근에서 예외 (판정 불가)
+            }
+            if ((OpcodeTable_32::Lookup(opcode) != nullptr) == capture.hit) mismatches.push_back(opcode);
+        }
+    }
+    INFO("first mismatch 0x" << std::hex << (mismatches.empty() ? 0 : mismatches[0]));
+    REQUIRE(mismatches.empty());
+}
+
+// 블록 메모리 명령 (10/11/12 XX YY ..) 한 번 실행: R1 = 목적지, R2 = 길이, I = 원본
+// 0x400부터 1, 2, ..., 16을 채워 두고, 실행 후 R15 (0 = 완료, 1 = 거부)를 돌려줌
+struct BlockMemory {
+    Chip8_32 chip8_32;
+
+    BlockMemory() {
+        for (int i = 0; i < 16; ++i) chip8_32.set_memory(0x400 + i, static_cast<uint8_t>(i + 1));
+    }
+
+    uint32_t run(uint32_t opcode, uint32_t dst, uint32_t length, uint32_t src = 0x400) {
+        load_program_32(chip8_32, {opcode});
+        chip8_32.set_R(1, dst);
+        chip8_32.set_R(2, length);
+        chip8_32.set_R(15, 7);
+        chip8_32.set_I(src);
+        chip8_32.cycle();
+        REQUIRE(chip8_32.get_pc() == 0x204);
+        REQUIRE(chip8_32.get_I() == src);
+        return chip8_32.get_R(15);
+    }
+
+    uint8_t at(uint32_t address) const { return chip8_32.peek_memory(address); }
+};
+
+TEST_CASE("10XXYY00: MEMCPY copies disjoint ranges and rejects the rest", "[opcode][block]") {
+    BlockMemory m;
+    REQUIRE(m.run(0x10010200, 0x500, 8) == 0);
+    REQUIRE(m.at(0x500) == 1);
+    REQUIRE(m.at(0x507) == 8);
+    REQUIRE(m.at(0x508) == 0);
+    REQUIRE(m.at(0x400) == 1);   // 원본 유지
+
+    REQUIRE(m.run(0x10010200, 0x600, 0) == 0);   // 길이 0은 아무것도 하지 않고 성공
+    REQUIRE(m.at(0x600) == 0);
+
+    // 겹치는 영역은 앞/뒤 방향 모두 거부 (메모리 그대로)
+    REQUIRE(m.run(0x10010200, 0x404, 8) == 1);
+    REQUIRE(m.run(0x10010200, 0x3FC, 8) == 1);
+    for (int i = 0; i < 16; ++i) REQUIRE(m.at(0x400 + i) == i + 1);
+    REQUIRE(m.at(0x3FC) == 0);
+
+    // 메모리 끝을 넘거나 길이가 주소 공간을 감싸면 거부
+    REQUIRE(m.run(0x10010200, MEMORY_SIZE_32 - 4, 8) == 1);
+    for (uint32_t a = MEMORY_SIZE_32 - 4; a < MEMORY_SIZE_32; ++a) REQUIRE(m.at(a) == 0);
+    REQUIRE(m.run(0x10010200, 0x10, 0xFFFFFFFF) == 1);
+    REQUIRE(m.at(0x10) == 0);
+    REQUIRE(m.run(0x10010200, 0x500, 8, MEMORY_SIZE_32 - 4) == 1);
+
+    // 끝에 딱 맞는 복사는 허용
+    REQUIRE(m.run(0x10010200, MEMORY_SIZE_32 - 8, 8) == 0);
+    REQUIRE(m.at(MEMORY_SIZE_32 - 1) == 8);
+}
+
+TEST_CASE("11XXYYKK: MEMSET fills in bounds and rejects the rest", "[opcode][block]") {
+    BlockMemory m;
+    REQUIRE(m.run(0x110102AB, 0x600, 4) == 0);
+    REQUIRE(m.at(0x5FF) == 0);
+    REQUIRE(m.at(0x600) == 0xAB);
+    REQUIRE(m.at(0x603) == 0xAB);
+    REQUIRE(m.at(0x604) == 0);
+
+    REQUIRE(m.run(0x110102CD, MEMORY_SIZE_32 - 2, 4) == 1);
+    REQUIRE(m.at(MEMORY_SIZE_32 - 2) == 0);
+    REQUIRE(m.at(MEMORY_SIZE_32 - 1) == 0);
+    REQUIRE(m.run(0x110102CD, MEMORY_SIZE_32 + 1, 0) == 1);   // 시작 주소가 메모리 밖
+    REQUIRE(m.run(0x110102CD, 0x600, 0) == 0);
+    REQUIRE(m.at(0x600) == 0xAB);
+}
+
+TEST_CASE("12XXYY00: MEMMOVE handles overlap in both directions", "[opcode][block]") {
+    BlockMemory forward;
+    REQUIRE(forward.run(0x12010200, 0x402, 6) == 0);   // 뒤로 겹침: 1..6 → 0x402..0x407
+    const uint8_t shifted[] = {1, 2, 1, 2, 3, 4, 5, 6, 9};
+    for (int i = 0; i < 9; ++i) REQUIRE(forward.at(0x400 + i) == shifted[i]);
+
+    BlockMemory backward;
+    REQUIRE(backward.run(0x12010200, 0x3FE, 6) == 0);  // 앞으로 겹침
+    const uint8_t moved[] = {1, 2, 3, 4, 5, 6, 5, 6, 7};
+    for (int i = 0; i < 9; ++i) REQUIRE(backward.at(0x3FE + i) == moved[i]);
+
+    BlockMemory rejected;
+    REQUIRE(rejected.run(0x12010200, 0x500, 4, MEMORY_SIZE_32 - 2) == 1);
+    REQUIRE(rejected.run(0x12010200, MEMORY_SIZE_32 - 2, 4) == 1);
+    REQUIRE(rejected.at(0x500) == 0);
+    REQUIRE(rejected.at(MEMORY_SIZE_32 - 1) == 0);
+}
+
+// 방언을 고른 뒤 (set_dialect는 reset) 0x200부터 opcode 기록
+static void load_dialect_program(Chip8& chip8, Dialect dialect, std::initializer_list<uint16_t> opcodes) {
+    chip8.set_dialect(dialect);
+    load_program(chip8, opcodes);
+}
+
+// 현재 해상도 기준 (x, y) 픽셀의 평면 1 비트
+static bool pixel(const Chip8& chip8, unsigned int x, unsigned int y) {
+    return chip8.get_video(static_cast<int>(y * chip8.video_width() + x)) & 1;
+}
+
+TEST_CASE("SUPER-CHIP: 00CN, 00FB, 00FC scroll and XO-CHIP 00DN", "[opcode][schip]") {
+    Chip8 chip8;
+    load_dialect_program(chip8, Dialect::SuperChip, {0x00FF, 0x00C3, 0x00FB, 0x00FC, 0x00D2});
+    chip8.cycle();
+    REQUIRE(chip8.is_hires());
+    chip8.set_video(10 * VIDEO_WIDTH_HI + 10, 1);
+
+    chip8.cycle();  // 아래로 3줄
+    REQUIRE(pixel(chip8, 10, 13));
+    REQUIRE_FALSE(pixel(chip8, 10, 10));
+    chip8.cycle();  // 오른쪽 4칸
+    REQUIRE(pixel(chip8, 14, 13));
+    chip8.cycle();  // 왼쪽 4칸
+    REQUIRE(pixel(chip8, 10, 13));
+    chip8.cycle();  // SUPER-CHIP의 00D2는 SYS (스크롤 안 함)
+    REQUIRE(pixel(chip8, 10, 13));
+    REQUIRE(chip8.get_pc() == 0x20A);
+
+    load_dialect_program(chip8, Dialect::XoChip, {0x00D2});
+    chip8.set_video(10 * VIDEO_WIDTH + 10, 1);
+    chip8.cycle();  // 위로 2줄
+    REQUIRE(pixel(chip8, 10, 8));
+    REQUIRE_FALSE(pixel(chip8, 10, 10));
+}
+
+TEST_CASE("SUPER-CHIP: 00FE/00FF switch resolution and 00FD halts", "[opcode][schip]") {
+    Chip8 chip8;
+    load_dialect_program(chip8, Dialect::SuperChip, {0x00FF, 0x00FE, 0x00FD, 0x6001});
+    chip8.set_video(0, 1);
+    chip8.cycle();
+    REQUIRE(chip8.video_width() == VIDEO_WIDTH_HI);
+    REQUIRE(chip8.get_video(0) == 0);   // 전환 시 화면을 지움
+    chip8.set_video(0, 1);
+    chip8.cycle();
+    REQUIRE(chip8.video_width() == VIDEO_WIDTH);
+    REQUIRE(chip8.get_video(0) == 0);
+
+    chip8.cycle();
+    REQUIRE(chip8.is_halted());
+    REQUIRE(chip8.get_pc() == 0x204);
+    chip8.cycle();  // 멈춘 뒤에는 실행하지 않음
+    REQUIRE(chip8.get_V(0) == 0);
+    REQUIRE(chip8.get_pc() == 0x204);
+}
+
+TEST_CASE("SUPER-CHIP: DXY0 draws 16x16 and reports collision in hires", "[opcode][schip]") {
+    Chip8 chip8;
+    load_dialect_program(chip8, Dialect::SuperChip, {0x00FF, 0x6008, 0x6110, 0xA300, 0xD000, 0xD110});
+    for (int i = 0; i < 32; ++i) chip8.set_memory(0x300 + i, 0xFF);
+    for (int i = 0; i < 5; ++i) chip8.cycle();
+    REQUIRE(chip8.get_V(0xF) == 0);
+    REQUIRE(pixel(chip8, 8, 8));
+    REQUIRE(pixel(chip8, 23, 23));
+    REQUIRE_FALSE(pixel(chip8, 24, 24));
+
+    chip8.cycle();  // (16, 16)에 다시 그림: 8x8 영역이 겹침
+    REQUIRE(chip8.get_V(0xF) == 1);
+    REQUIRE_FALSE(pixel(chip8, 16, 16));
+    REQUIRE_FALSE(pixel(chip8, 23, 23));
+    REQUIRE(pixel(chip8, 8, 8));
+    REQUIRE(pixel(chip8, 31, 31));
+
+    // 원본 CHIP-8의 DXY0은 높이 0 (아무것도 그리지 않음)
+    load_dialect_program(chip8, Dialect::Chip8, {0xA300, 0xD000});
+    for (int i = 0; i < 32; ++i) chip8.set_memory(0x300 + i, 0xFF);
+    chip8.cycle();
+    chip8.cycle();
+    REQUIRE(chip8.get_V(0xF) == 0);
+    REQUIRE_FALSE(pixel(chip8, 0, 0));
+}
+
+TEST_CASE("SUPER-CHIP: FX30 big font and FX75/FX85 RPL flags", "[opcode][schip]") {
+    Chip8 chip8;
+    load_dialect_program(chip8, Dialect::SuperChip, {0xF130, 0xF275, 0x6000, 0x6100, 0x6200, 0xF185});
+    chip8.set_V(0, 0x11);
+    chip8.set_V(1, 7);
+    chip8.set_V(2, 0x33);
+    chip8.set_V(3, 0x44);
+    chip8.cycle();
+    REQUIRE(chip8.get_I() == BIG_FONT_ADDRESS + 7 * 10);
+
+    chip8.cycle();  // V0..V2 저장
+    REQUIRE(chip8.get_rpl(0) == 0x11);
+    REQUIRE(chip8.get_rpl(1) == 7);
+    REQUIRE(chip8.get_rpl(2) == 0x33);
+    REQUIRE(chip8.get_rpl(3) == 0);
+    for (int i = 0; i < 4; ++i) chip8.cycle();  // V0..V2를 지우고 V0..V1만 읽음
+    REQUIRE(chip8.get_V(0) == 0x11);
+    REQUIRE(chip8.get_V(1) == 7);
+    REQUIRE(chip8.get_V(2) == 0);
+    REQUIRE(chip8.get_V(3) == 0x44);
+
+    // XO-CHIP 큰 폰트는 0~F
+    load_dialect_program(chip8, Dialect::XoChip, {0xF130});
+    chip8.set_V(1, 0xC);
+    chip8.cycle();
+    REQUIRE(chip8.get_I() == BIG_FONT_ADDRESS + 0xC * 10);
+}
+
+TEST_CASE("XO-CHIP: F000 NNNN, F002, FN01 and FX3A", "[opcode][xochip]") {
+    Chip8 chip8;
+    load_dialect_program(chip8, Dialect::XoChip, {0xF000, 0xE123, 0xF002, 0xF201, 0xF33A});
+    chip8.cycle();
+    REQUIRE(chip8.get_I() == 0xE123);
+    REQUIRE(chip8.get_pc() == 0x204);
+
+    for (int i = 0; i < 16; ++i) chip8.set_memory(0xE123 + i, static_cast<uint8_t>(0xA0 + i));
+    chip8.cycle();
+    REQUIRE(chip8.get_audio_pattern()[0] == 0xA0);
+    REQUIRE(chip8.get_audio_pattern()[15] == 0xAF);
+    REQUIRE(chip8.get_I() == 0xE123);
+
+    chip8.cycle();
+    REQUIRE(chip8.get_planes() == 2);
+
+    chip8.set_V(3, 200);
+    chip8.cycle();
+    REQUIRE(chip8.get_audio_pitch() == 200);
+    REQUIRE(chip8.get_pc() == 0x20A);
+}
+
+TEST_CASE("XO-CHIP: 5XY2/5XY3 save and load ranges in both directions", "[opcode][xochip]") {
+    Chip8 chip8;
+    load_dialect_program(chip8, Dialect::XoChip, {0xA300, 0x5132, 0xA310, 0x5312, 0xA310, 0x5643});
+    chip8.set_V(1, 0x11);
+    chip8.set_V(2, 0x22);
+    chip8.set_V(3, 0x33);
+
+    chip8.cycle();
+    chip8.cycle();  // x < y: V1, V2, V3 순서
+    REQUIRE(chip8.get_memory(0x300) == 0x11);
+    REQUIRE(chip8.get_memory(0x301) == 0x22);
+    REQUIRE(chip8.get_memory(0x302) == 0x33);
+    REQUIRE(chip8.get_I() == 0x300);   // I는 그대로
+
+    chip8.cycle();
+    chip8.cycle();  // x > y: V3, V2, V1 순서
+    REQUIRE(chip8.get_memory(0x310) == 0x33);
+    REQUIRE(chip8.get_memory(0x311) == 0x22);
+    REQUIRE(chip8.get_memory(0x312) == 0x11);
+    REQUIRE(chip8.get_memory(0x313) == 0);
+
+    chip8.cycle();
+    chip8.cycle();  // 5XY3, x > y: V6 = [I], V5 = [I+1], V4 = [I+2]
+    REQUIRE(chip8.get_V(6) == 0x33);
+    REQUIRE(chip8.get_V(5) == 0x22);
+    REQUIRE(chip8.get_V(4) == 0x11);
+    REQUIRE(chip8.get_I() == 0x310);
+}
+
+TEST_CASE("XO-CHIP: Conditional skips step over the whole F000 NNNN", "[opcode][xochip]") {
+    // 각 명령어는 조건이 참이 되도록 준비: V0 = 5, V1 = 6, 키 5 눌림 (EXA1은 키 6 검사)
+    const uint16_t skips[] = {0x3005, 0x4000, 0x5020, 0x9010, 0xE09E, 0xE1A1};
+    for (uint16_t skip : skips) {
+        INFO(std::hex << skip);
+        for (Dialect dialect : {Dialect::SuperChip, Dialect::XoChip}) {
+            Chip8 chip8;
+            load_dialect_program(chip8, dialect, {skip, 0xF000, 0x1234});
+            chip8.set_V(0, 5);
+            chip8.set_V(1, 6);
+            chip8.set_V(2, 5);
+            chip8.set_key(5, 1);
+            chip8.cycle();
+            REQUIRE(chip8.get_pc() == (dialect == Dialect::XoChip ? 0x206 : 0x204));
+        }
+    }
+
+    // 건너뛸 명령어가 2바이트면 XO-CHIP도 2바이트만 건너뜀
+    Chip8 chip8;
+    load_dialect_program(chip8, Dialect::XoChip, {0x3000, 0x6001});
+    chip8.cycle();
+    REQUIRE(chip8.get_pc() == 0x204);
+}
+
+// 14 01 02 ZZ 한 번 실행: R1 = rx, R2 = ry로 시작해 결과 R1을 돌려줌 (R2, R15 보존과 PC + 4 확인)
+static uint32_t run_packed(uint8_t zz, uint32_t rx, uint32_t ry) {
+    Chip8_32 chip8_32;
+    load_program_32(chip8_32, {0x14010200u | zz});
+    chip8_32.set_R(1, rx);
+    chip8_32.set_R(2, ry);
+    chip8_32.set_R(15, 0x5A5A5A5A);
+    chip8_32.cycle();
+    REQUIRE(chip8_32.get_R(2) == ry);
+    REQUIRE(chip8_32.get_R(15) == 0x5A5A5A5Au);
+    REQUIRE(chip8_32.get_pc() == 0x204);
+    return chip8_32.get_R(1);
+}
+
+TEST_CASE("14XXYYZZ: Saturating lane add and subtract", "[opcode][swar]") {
+    // PADDUSB: 레인별 포화, 옆 레인으로 carry가 넘어가지 않음
+    REQUIRE(run_packed(0x00, 0xFF7F0100, 0x01810100) == 0xFFFF0200u);
+    REQUIRE(run_packed(0x00, 0x000000FF, 0x00000001) == 0x000000FFu);
+    REQUIRE(run_packed(0x00, 0x80808080, 0x7F7F7F7F) == 0xFFFFFFFFu);
+
+    // PSUBUSB: 0 - 1은 0, 옆 레인에서 빌려오지 않음
+    REQUIRE(run_packed(0x01, 0x00108005, 0x01010106) == 0x000F7F00u);
+    REQUIRE(run_packed(0x01, 0x00000100, 0x00000001) == 0x00000100u);
+
+    // PADDUSW / PSUBUSW: 16비트 레인
+    REQUIRE(run_packed(0x02, 0xFFFF7FFF, 0x00010001) == 0xFFFF8000u);
+    REQUIRE(run_packed(0x02, 0x0000FFFF, 0x00000001) == 0x0000FFFFu);
+    REQUIRE(run_packed(0x03, 0x00008000, 0x00010001) == 0x00007FFFu);
+    REQUIRE(run_packed(0x03, 0x00010000, 0x00000001) == 0x00010000u);
+}
+
+TEST_CASE("14XXYYZZ: Lane compares produce full-lane masks", "[opcode][swar]") {
+    REQUIRE(run_packed(0x04, 0x11223344, 0x11FF3300) == 0xFF00FF00u);   // PCMPEQB
+    REQUIRE(run_packed(0x04, 0x00000000, 0x00000000) == 0xFFFFFFFFu);
+    REQUIRE(run_packed(0x05, 0x80017F00, 0x7F027F00) == 0xFF000000u);   // PCMPGTB (부호 없음)
+    REQUIRE(run_packed(0x05, 0xFF000001, 0x00FF0000) == 0xFF0000FFu);
+    REQUIRE(run_packed(0x06, 0x1234ABCD, 0x1234ABCE) == 0xFFFF0000u);   // PCMPEQW
+    REQUIRE(run_packed(0x07, 0x80000001, 0x7FFF0002) == 0xFFFF0000u);   // PCMPGTW (부호 없음)
+    REQUIRE(run_packed(0x07, 0x0000FFFF, 0x0001FFFE) == 0x0000FFFFu);
+}
+
+TEST_CASE("14XXYYZZ: Shuffle, popcount and register writeback", "[opcode][swar]") {
+    // PSHUFB: Ry 하위 8비트만 선택자로 사용
+    REQUIRE(run_packed(0x08, 0x11223344, 0xFFFFFF1B) == 0x44332211u);   // 0x1B = 바이트 순서 뒤집기
+    REQUIRE(run_packed(0x08, 0x11223344, 0x00000000) == 0x44444444u);   // 레인 0 복제
+    REQUIRE(run_packed(0x08, 0x11223344, 0x000000E4) == 0x11223344u);   // 항등
+
+    // PCNTB: Rx = Ry 레인별 popcount (Rx 이전 값은 쓰지 않음)
+    REQUIRE(run_packed(0x09, 0xDEADBEEF, 0xFF0F0100) == 0x08040100u);
+    REQUIRE(run_packed(0x09, 0x00000000, 0x80C0E0F0) == 0x01020304u);
+
+    // 정의되지 않은 ZZ는 Rx를 바꾸지 않음
+    REQUIRE(run_packed(0x0A, 0x12345678, 0xFFFFFFFF) == 0x12345678u);
+
+    // X == Y: 같은 레지스터를 읽고 씀
+    Chip8_32 chip8_32;
+    load_program_32(chip8_32, {0x14030300, 0x14040409});
+    chip8_32.set_R(3, 0x80402001);
+    chip8_32.set_R(4, 0x0000FFFF);
+    chip8_32.cycle();
+    chip8_32.cycle();
+    REQUIRE(chip8_32.get_R(3) == 0xFF804002u);
+    REQUIRE(chip8_32.get_R(4) == 0x00000808u);
+    REQUIRE(chip8_32.get_pc() == 0x208);
+}
+
+TEST_CASE("Disassembler: 8-bit listing follows the core's dialect", "[disasm]") {
+    using chip8emu::Disassembler;
+    using chip8emu::Isa;
+    REQUIRE(Disassembler::format(Isa::Chip8, 0x00FF, Dialect::Chip8) == "SYS 0x0FF");
+    REQUIRE(Disassembler::format(Isa::Chip8, 0x00FF, Dialect::SuperChip) == "HIGH");
+    REQUIRE(Disassembler::format(Isa::Chip8, 0x5012, Dialect::Chip8) == "DW 0x5012");
+    REQUIRE(Disassembler::format(Isa::Chip8, 0x5012, Dialect::XoChip) == "SAVE V0 - V1");
+    REQUIRE(Disassembler::format(Isa::Chip8, 0xF002, Dialect::SuperChip) == "DW 0xF002");
+
+    // 캐시는 방언이 바뀌면 다시 해석
+    Disassembler disasm(Isa::Chip8, MEMORY_SIZE_XO, Dialect::Chip8);
+    REQUIRE(disasm.at(0x200, 0x00FD) == "SYS 0x0FD");
+    disasm.set_dialect(Dialect::SuperChip);
+    REQUIRE(disasm.at(0x200, 0x00FD) == "EXIT");
+}
+
+TEST_CASE("Disassembler: XO-CHIP F000 NNNN is one 4-byte instruction", "[disasm]") {
+    using chip8emu::Disassembler;
+    using chip8emu::Isa;
+    REQUIRE(Disassembler::format(Isa::Chip8, 0xF000, Dialect::XoChip, 0x1234) == "LD I, 0x1234");
+
+    Disassembler disasm(Isa::Chip8, MEMORY_SIZE_XO, Dialect::XoChip);
+    REQUIRE(disasm.at(0x200, 0xF000, 0x1234) == "LD I, 0x1234");
+    REQUIRE(disasm.at(0x200, 0xF000, 0xABCD) == "LD I, 0xABCD");   // 주소가 바뀌면 다시 해석
+
+    const uint8_t rom[] = {0xF0, 0x00, 0x12, 0x34, 0x60, 0x01};
+    std::ostringstream xo;
+    Disassembler::dump(Isa::Chip8, Dialect::XoChip, rom, sizeof(rom), 0x200, xo);
+    REQUIRE(xo.str() == "0200: F000 1234  LD I, 0x1234\n"
+                        "0204: 6001  LD V0, 0x01\n");
+
+    // 다른 방언에서 F000은 미정의 2바이트 명령어
+    std::ostringstream schip;
+    Disassembler::dump(Isa::Chip8, Dialect::SuperChip, rom, sizeof(rom), 0x200, schip);
+    REQUIRE(schip.str() == "0200: F000  DW 0xF000\n"
+                           "0202: 1234  JP 0x234\n"
+                           "0204: 6001  LD V0, 0x01\n");
+}
+
+using chip8emu::Expression;
+
+// 컴파일에 성공해야 하는 식을 8비트 코어에서 평가
+static uint32_t eval8(const std::string& source, const Chip8& chip8) {
+    std::string error;
+    std::optional<Expression> expr = Expression::compile(source, Expression::Isa::Chip8, &error);
+    INFO(source << ": " << error);
+    REQUIRE(expr.has_value());
+    return expr->evaluate(chip8);
+}
+
+static bool compiles(const std::string& source, Expression::Isa isa) {
+    return Expression::compile(source, isa).has_value();
+}
+
+TEST_CASE("Expression: Operator precedence", "[expression]") {
+    Chip8 chip8;
+    chip8.set_V(3, 0x10);
+    chip8.set_I(0x301);
+    REQUIRE(eval8("V3 == 0x10 && I > 0x300", chip8) == 1);
+    chip8.set_I(0x300);
+    REQUIRE(eval8("V3 == 0x10 && I > 0x300", chip8) == 0);
+    chip8.set_I(0x301);
+    chip8.set_V(3, 0x11);
+    REQUIRE(eval8("V3 == 0x10 && I > 0x300", chip8) == 0);
+
+    REQUIRE(eval8("1 + 2 == 3", chip8) == 1);         // + 가 == 보다 먼저
+    REQUIRE(eval8("1 | 2 & 0", chip8) == 1);          // & 가 | 보다 먼저
+    REQUIRE(eval8("3 ^ 1 | 4", chip8) == 6);          // ^ 가 | 보다 먼저
+    REQUIRE(eval8("1 || 0 && 0", chip8) == 1);        // && 가 || 보다 먼저
+    REQUIRE(eval8("(1 || 0) && 0", chip8) == 0);
+    REQUIRE(eval8("2 < 3 == 1", chip8) == 1);         // 비교가 == 보다 먼저
+    REQUIRE(eval8("!V0 == 1", chip8) == 1);           // 단항이 가장 먼저
+    REQUIRE(eval8("-1", chip8) == 0xFFFFFFFFu);
+    REQUIRE(eval8("10 - 2 - 3", chip8) == 5);         // 왼쪽 결합
+}
+
+TEST_CASE("Expression: Numbers are hex with 0x and decimal otherwise", "[expression]") {
+    Chip8 chip8;
+    REQUIRE(eval8("010", chip8) == 10);               // 8진수로 읽지 않음
+    REQUIRE(eval8("0x10", chip8) == 16);
+    REQUIRE(eval8("0X1f", chip8) == 31);
+    REQUIRE(eval8("0xFFFFFFFF", chip8) == 0xFFFFFFFFu);
+    REQUIRE_FALSE(compiles("0x", Expression::Isa::Chip8));
+    REQUIRE_FALSE(compiles("0xG", Expression::Isa::Chip8));
+    REQUIRE_FALSE(compiles("0x100000000", Expression::Isa::Chip8));
+    REQUIRE_FALSE(compiles("4294967296", Expression::Isa::Chip8));
+    REQUIRE_FALSE(compiles("019a", Expression::Isa::Chip8));
+}
+
+TEST_CASE("Expression: Registers, special registers and memory for both ISAs", "[expression]") {
+    Chip8 chip8;
+    chip8.set_V(0xF, 7);
+    chip8.set_V(0xA, 3);
+    chip8.set_I(0x300);
+    chip8.set_memory(0x301, 0x5A);
+    REQUIRE(eval8("VF", chip8) == 7);
+    REQUIRE(eval8("va + vf", chip8) == 10);           // 대소문자 무관
+    REQUIRE(eval8("[I + 1]", chip8) == 0x5A);
+    REQUIRE(eval8("PC == 0x200 && SP == 0", chip8) == 1);
+    REQUIRE_FALSE(compiles("V10", Expression::Isa::Chip8));
+    REQUIRE_FALSE(compiles("VG", Expression::Isa::Chip8));
+    REQUIRE_FALSE(compiles("R1", Expression::Isa::Chip8));
+
+    Chip8_32 chip8_32;
+    chip8_32.set_R(31, 0xDEADBEEF);
+    chip8_32.set_R(9, 1);
+    std::optional<Expression> expr = Expression::compile("R31 + R9", Expression::Isa::Chip8_32);
+    REQUIRE(expr.has_value());
+    REQUIRE(expr->evaluate(chip8_32) == 0xDEADBEF0u);
+    REQUIRE(compiles("r0 == 0", Expression::Isa::Chip8_32));
+    REQUIRE_FALSE(compiles("R32", Expression::Isa::Chip8_32));
+    REQUIRE_FALSE(compiles("R100", Expression::Isa::Chip8_32));
+    REQUIRE_FALSE(compiles("V0", Expression::Isa::Chip8_32));
+}
+
+TEST_CASE("Expression: Evaluation stack depth is limited to MAX_STACK", "[expression]") {
+    // 1 + (1 + (1 + ...)): n개의 피연산자가 모두 스택에 쌓임
+    auto nested = [](std::size_t operands) {
+        std::string source = "1";
+        for (std::size_t i = 1; i < operands; ++i) source = "1 + (" + source + ")";
+        return source;
+    };
+
+    Chip8 chip8;
+    REQUIRE(eval8(nested(Expression::MAX_STACK), chip8) == Expression::MAX_STACK);
+
+    std::string error;
+    REQUIRE_FALSE(Expression::compile(nested(Expression::MAX_STACK + 1), Expression::Isa::Chip8, &error));
+    REQUIRE(error == "expression too deep");
+
+    // 왼쪽 결합은 깊이가 늘지 않음
+    std::string flat = "1";
+    for (std::size_t i = 1; i < Expression::MAX_STACK * 4; ++i) flat += " + 1";
+    REQUIRE(eval8(flat, chip8) == Expression::MAX_STACK * 4);
+}
+
+TEST_CASE("Expression: Malformed input is rejected with a column", "[expression]") {
+    const char* malformed[] = {
+        "", "   ", "V3 ==", "(V3", "V3)", "[I", "V3 = 1", "1 2", "V3 $ 1", "&& 1", "I >", "!", "()", "[]",
+    };
+    for (const char* source : malformed) {
+        INFO(source);
+        std::string error;
+        REQUIRE_FALSE(Expression::compile(source, Expression::Isa::Chip8, &error));
+        REQUIRE(error.find("column") != std::string::npos);
+    }
 }